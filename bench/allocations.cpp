@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include "bench.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+
+auto allocate(const std::size_t size) -> void * {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	void *ptr = std::malloc(size == 0 ? 1 : size); // NOLINT(cppcoreguidelines-no-malloc)
+	if(ptr == nullptr) {
+		throw std::bad_alloc{};
+	}
+	return ptr;
+}
+
+// over aligned blocks keep the pointer malloc returned right before them
+auto allocate_aligned(const std::size_t size, const std::align_val_t align) -> void * {
+	const auto alignment = static_cast<std::uintptr_t>(align);
+	auto *raw = static_cast<std::byte *>(allocate(size + alignment + sizeof(void *)));
+	const auto address = reinterpret_cast<std::uintptr_t>(raw + sizeof(void *)); // NOLINT(*-reinterpret-cast)
+	auto *aligned = raw + sizeof(void *) + ((alignment - (address % alignment)) % alignment);
+	*(reinterpret_cast<void **>(aligned) - 1) = raw; // NOLINT(*-reinterpret-cast)
+	return aligned;
+}
+
+auto free_aligned(void *ptr) noexcept -> void {
+	if(ptr != nullptr) {
+		std::free(*(static_cast<void **>(ptr) - 1)); // NOLINT(cppcoreguidelines-no-malloc)
+	}
+}
+} // namespace
+
+auto pxe::bench::get_allocations() -> std::size_t {
+	return allocations.load(std::memory_order_relaxed);
+}
+
+// the array and nothrow forms end up in these
+auto operator new(const std::size_t size) -> void * {
+	return allocate(size);
+}
+
+auto operator new(const std::size_t size, const std::align_val_t align) -> void * {
+	return allocate_aligned(size, align);
+}
+
+auto operator delete(void *ptr) noexcept -> void {
+	std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+auto operator delete(void *ptr, std::size_t /*size*/) noexcept -> void {
+	std::free(ptr); // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+auto operator delete(void *ptr, const std::align_val_t /*align*/) noexcept -> void {
+	free_aligned(ptr);
+}
+
+auto operator delete(void *ptr, std::size_t /*size*/, const std::align_val_t /*align*/) noexcept -> void {
+	free_aligned(ptr);
+}
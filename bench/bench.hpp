@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace pxe::bench {
+
+using clock = std::chrono::steady_clock;
+
+// global operator new calls since the program started, counted by allocations.cpp
+[[nodiscard]] auto get_allocations() -> std::size_t;
+
+// calls func the given times and returns the nanoseconds per call
+template<typename Func>
+[[nodiscard]] auto time_per_call(const std::size_t times, Func &&func) -> double {
+	const auto start = clock::now();
+	for(std::size_t i = 0; i < times; ++i) {
+		func();
+	}
+	return std::chrono::duration<double, std::nano>(clock::now() - start).count() / static_cast<double>(times);
+}
+
+} // namespace pxe::bench
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+// short lived components spawned and despawned every frame, with other heap traffic in between, once
+// the pools have grown spawning should not reach the global allocator
+
+#include "bench.hpp"
+
+#include <pxe/app.hpp>
+#include <pxe/components/component.hpp>
+#include <pxe/components/component_pool.hpp>
+#include <pxe/result.hpp>
+#include <pxe/scenes/scene.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace {
+
+class bullet final: public pxe::component {
+public:
+	[[nodiscard]] auto update(const float delta) -> pxe::result<> override {
+		x_ += speed_x_ * delta;
+		y_ += speed_y_ * delta;
+		return true;
+	}
+
+private:
+	float x_{0.0F};
+	float y_{0.0F};
+	float speed_x_{120.0F};
+	float speed_y_{-40.0F};
+};
+
+constexpr std::size_t live_bullets = 2048;
+constexpr std::size_t spawned_per_frame = 64;
+constexpr std::size_t frames = 2000;
+constexpr std::size_t live_noise = 4096;
+constexpr std::size_t spawns = 200000;
+constexpr auto delta = 0.016F;
+
+} // namespace
+
+auto main() -> int {
+	// never run, the scene only keeps a reference to it for the components it creates
+	pxe::app app{"bench", "pxe", "bench", "", {.width = 1280, .height = 720}};
+	pxe::scene scene;
+	if(scene.init(app).has_error()) {
+		return EXIT_FAILURE;
+	}
+
+	std::deque<pxe::component_handle<bullet>> live;
+	// unrelated allocations of mixed sizes, as the rest of a game would make between spawns
+	std::deque<std::unique_ptr<std::byte[]>> noise; // NOLINT(*-avoid-c-arrays)
+	double update_time = 0.0;
+	for(std::size_t frame = 0; frame < frames; ++frame) {
+		for(std::size_t i = 0; i < spawned_per_frame; ++i) {
+			auto added = scene.add_component<bullet>();
+			if(added.has_error()) {
+				return EXIT_FAILURE;
+			}
+			live.push_back(added.get_value());
+			noise.push_back(std::make_unique<std::byte[]>(48 + ((i % 5) * 16))); // NOLINT(*-avoid-c-arrays)
+		}
+		while(live.size() > live_bullets) {
+			if(scene.remove_component(live.front()).has_error()) {
+				return EXIT_FAILURE;
+			}
+			live.pop_front();
+		}
+		while(noise.size() > live_noise) {
+			noise.pop_front();
+		}
+		const auto start = pxe::bench::clock::now();
+		if(scene.update(delta).has_error()) {
+			return EXIT_FAILURE;
+		}
+		update_time += std::chrono::duration<double, std::micro>(pxe::bench::clock::now() - start).count();
+	}
+
+	bool failed = false;
+	auto allocations = pxe::bench::get_allocations();
+	const auto per_spawn = pxe::bench::time_per_call(spawns, [&scene, &failed]() -> void {
+		auto added = scene.add_component<bullet>();
+		failed = added.has_error() || scene.remove_component(added.get_value()).has_error() || failed;
+	});
+	const auto spawn_allocations = pxe::bench::get_allocations() - allocations;
+	if(failed) {
+		return EXIT_FAILURE;
+	}
+
+	// the component alone, pooled against the global allocator
+	allocations = pxe::bench::get_allocations();
+	const auto per_pooled = pxe::bench::time_per_call(spawns, []() -> void {
+		auto comp = std::allocate_shared<bullet>(pxe::pool_allocator<bullet>{});
+	});
+	const auto pooled_allocations = pxe::bench::get_allocations() - allocations;
+
+	allocations = pxe::bench::get_allocations();
+	const auto per_shared = pxe::bench::time_per_call(spawns, []() -> void { auto comp = std::make_shared<bullet>(); });
+	const auto shared_allocations = pxe::bench::get_allocations() - allocations;
+
+	const auto count = static_cast<double>(spawns);
+	std::printf("%zu live bullets, %zu spawned and despawned per frame: update %.1f us per frame\n",
+				live.size(),
+				spawned_per_frame,
+				update_time / static_cast<double>(frames));
+	std::printf("scene spawn + despawn: %.1f ns, %.2f global allocations per spawn\n",
+				per_spawn,
+				static_cast<double>(spawn_allocations) / count);
+	std::printf("allocate_shared with pool_allocator: %.1f ns, %.2f global allocations per component\n",
+				per_pooled,
+				static_cast<double>(pooled_allocations) / count);
+	std::printf("make_shared: %.1f ns, %.2f global allocations per component\n",
+				per_shared,
+				static_cast<double>(shared_allocations) / count);
+
+	return scene.end().has_error() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+// dispatch cost against the number of subscribers of the event type, the handler list is walked in
+// place so the cost per handler should stay flat and nothing should be allocated
+
+#include "bench.hpp"
+
+#include <pxe/events.hpp>
+#include <pxe/result.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+struct click {
+	std::size_t id;
+};
+
+struct listener {
+	std::size_t seen{0};
+
+	auto on_click(const click &event) -> pxe::result<> {
+		seen += event.id;
+		return true;
+	}
+};
+
+constexpr std::size_t handler_calls = 2000000;
+constexpr std::size_t events_per_dispatch = 32;
+
+} // namespace
+
+auto main() -> int {
+	for(const std::size_t subscribers: {1, 4, 16, 64, 256, 1024}) {
+		pxe::event_bus bus;
+		std::vector<listener> listeners(subscribers);
+		for(auto &item: listeners) {
+			bus.subscribe<click>([owner = &item](const click &event) -> pxe::result<> { return owner->on_click(event); });
+		}
+
+		// the queue swaps its pending and dispatching buffers, grow both like earlier frames would
+		for(std::size_t round = 0; round < 2; ++round) {
+			for(std::size_t i = 0; i < events_per_dispatch; ++i) {
+				bus.post(click{.id = 1});
+			}
+			if(bus.dispatch().has_error()) {
+				return EXIT_FAILURE;
+			}
+		}
+
+		bool failed = false;
+		std::size_t posted = 0;
+		const auto events = handler_calls / subscribers;
+		const auto allocations = pxe::bench::get_allocations();
+		const auto per_event = pxe::bench::time_per_call(events, [&bus, &failed, &posted]() -> void {
+			bus.post(click{.id = 1});
+			if(++posted % events_per_dispatch == 0) {
+				failed = bus.dispatch().has_error() || failed;
+			}
+		});
+		failed = bus.dispatch().has_error() || failed;
+		if(failed) {
+			return EXIT_FAILURE;
+		}
+
+		std::printf("%5zu subscribers: %9.1f ns per event, %5.2f ns per handler call, %.4f allocations per event\n",
+					subscribers,
+					per_event,
+					per_event / static_cast<double>(subscribers),
+					static_cast<double>(pxe::bench::get_allocations() - allocations) / static_cast<double>(events));
+	}
+	return EXIT_SUCCESS;
+}
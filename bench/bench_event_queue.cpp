@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+// posting and dispatching events in steady state, once the queues have grown they should not allocate
+
+#include "bench.hpp"
+
+#include <pxe/events.hpp>
+#include <pxe/result.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+struct click {
+	std::size_t id;
+};
+
+struct value_changed {
+	std::size_t id;
+	float value;
+	bool muted;
+};
+
+constexpr std::size_t events_per_frame = 64;
+constexpr std::size_t warmup_frames = 3;
+constexpr std::size_t frames = 10000;
+
+auto post_frame(pxe::event_bus &bus) -> void {
+	for(std::size_t i = 0; i < events_per_frame; ++i) {
+		bus.post(click{.id = i});
+		bus.post(value_changed{.id = i, .value = 0.5F, .muted = false});
+	}
+}
+
+} // namespace
+
+auto main() -> int {
+	pxe::event_bus bus;
+	std::size_t seen = 0;
+	const auto click_token = bus.subscribe<click>([&seen](const click &event) -> pxe::result<> {
+		seen += event.id;
+		return true;
+	});
+	const auto changed_token = bus.subscribe<value_changed>([&seen](const value_changed &event) -> pxe::result<> {
+		seen += event.id;
+		return true;
+	});
+
+	for(std::size_t frame = 0; frame < warmup_frames; ++frame) {
+		post_frame(bus);
+		if(bus.dispatch().has_error()) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	bool failed = false;
+	const auto allocations = pxe::bench::get_allocations();
+	const auto per_frame = pxe::bench::time_per_call(frames, [&bus, &failed]() -> void {
+		post_frame(bus);
+		failed = bus.dispatch().has_error() || failed;
+	});
+	if(failed) {
+		return EXIT_FAILURE;
+	}
+
+	const auto events = static_cast<double>(frames * events_per_frame * 2);
+	std::printf("%zu events per frame, post + dispatch: %.1f ns per event, %.4f allocations per event\n",
+				events_per_frame * 2,
+				per_frame / static_cast<double>(events_per_frame * 2),
+				static_cast<double>(pxe::bench::get_allocations() - allocations) / events);
+	std::printf("handlers saw %zu\n", seen);
+
+	bus.unsubscribe(click_token);
+	bus.unsubscribe(changed_token);
+	return EXIT_SUCCESS;
+}
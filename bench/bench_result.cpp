@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+// a pass over 10k components returning result<> from update, checked with the usual unwrap pattern,
+// the success path should cost little more than the virtual calls. the same pass runs with the
+// variant based result the engine used before, kept here as legacy_result, to compare both
+
+#include "bench.hpp"
+
+#include <pxe/components/component.hpp>
+#include <pxe/result.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <source_location>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+// the error and result types as they were before result<> was reworked
+class legacy_error {
+public:
+	explicit legacy_error(const std::string &message,
+						  const std::source_location &location = std::source_location::current())
+		: causes_{cause{.message = message, .location = location}} {}
+
+	legacy_error(const std::string &message,
+				 const legacy_error &other,
+				 const std::source_location &location = std::source_location::current())
+		: causes_{cause{.message = message, .location = location}} {
+		causes_.insert(causes_.end(), other.causes_.begin(), other.causes_.end());
+	}
+
+private:
+	struct cause {
+		std::string message;
+		std::source_location location;
+	};
+
+	std::vector<cause> causes_;
+};
+
+template<class Value = bool, class Error = legacy_error>
+class legacy_result: public std::variant<Value, Error> {
+public:
+	// NOLINTNEXTLINE(google-explicit-constructor)
+	legacy_result(const Value &value): std::variant<Value, Error>(value) {}
+
+	// NOLINTNEXTLINE(google-explicit-constructor)
+	legacy_result(const Error &error): std::variant<Value, Error>(error) {}
+
+	[[nodiscard]] auto has_error() const noexcept {
+		return std::holds_alternative<Error>(*this);
+	}
+
+	auto unwrap() const noexcept -> std::optional<Error> {
+		if(has_error()) {
+			return std::get<Error>(*this);
+		}
+		return std::nullopt;
+	}
+};
+
+class legacy_component {
+public:
+	legacy_component() = default;
+	virtual ~legacy_component() = default;
+
+	legacy_component(const legacy_component &) = delete;
+	auto operator=(const legacy_component &) -> legacy_component & = delete;
+	legacy_component(legacy_component &&) = delete;
+	auto operator=(legacy_component &&) -> legacy_component & = delete;
+
+	[[nodiscard]] virtual auto update(float delta) -> legacy_result<> = 0;
+};
+
+class legacy_mover final: public legacy_component {
+public:
+	explicit legacy_mover(const float limit): limit_{limit} {}
+
+	[[nodiscard]] auto update(const float delta) -> legacy_result<> override {
+		x_ += speed_ * delta;
+		if(x_ > limit_) {
+			return legacy_error("component moved too far");
+		}
+		return true;
+	}
+
+private:
+	float x_{0.0F};
+	float speed_{1.0F};
+	float limit_;
+};
+
+[[nodiscard]] auto legacy_update_all(const std::vector<std::unique_ptr<legacy_component>> &components,
+									 const float delta) -> legacy_result<> {
+	for(const auto &comp: components) {
+		if(const auto err = comp->update(delta).unwrap(); err) {
+			return legacy_error("failed to update component", *err);
+		}
+	}
+	return true;
+}
+
+class mover final: public pxe::component {
+public:
+	explicit mover(const float limit): limit_{limit} {}
+
+	[[nodiscard]] auto update(const float delta) -> pxe::result<> override {
+		x_ += speed_ * delta;
+		if(x_ > limit_) {
+			return pxe::error("component moved too far");
+		}
+		return true;
+	}
+
+private:
+	float x_{0.0F};
+	float speed_{1.0F};
+	float limit_;
+};
+
+[[nodiscard]] auto update_all(const std::vector<std::unique_ptr<pxe::component>> &components, const float delta)
+	-> pxe::result<> {
+	for(const auto &comp: components) {
+		if(const auto err = comp->update(delta).unwrap(); err) {
+			return pxe::error("failed to update component", *err);
+		}
+	}
+	return true;
+}
+
+constexpr std::size_t component_count = 10000;
+constexpr std::size_t warmup_passes = 50;
+constexpr std::size_t passes = 2000;
+constexpr std::size_t failures = 100000;
+constexpr auto delta = 0.016F;
+
+// times the success pass over the components and a pass where a single component fails
+template<typename Component, typename Mover, typename Update>
+[[nodiscard]] auto measure(Update update) -> std::optional<std::pair<double, double>> {
+	std::vector<std::unique_ptr<Component>> components;
+	components.reserve(component_count);
+	for(std::size_t i = 0; i < component_count; ++i) {
+		components.push_back(std::make_unique<Mover>(1.0e30F));
+	}
+
+	for(std::size_t i = 0; i < warmup_passes; ++i) {
+		if(update(components, delta).has_error()) {
+			return std::nullopt;
+		}
+	}
+
+	bool failed = false;
+	const auto per_pass = pxe::bench::time_per_call(passes, [&components, &failed, &update]() -> void {
+		failed = update(components, delta).has_error() || failed;
+	});
+	if(failed) {
+		return std::nullopt;
+	}
+
+	// one component failing every time, the error and its cause are built and dropped
+	std::vector<std::unique_ptr<Component>> failing;
+	failing.push_back(std::make_unique<Mover>(-1.0F));
+	std::size_t reported = 0;
+	const auto per_failure = pxe::bench::time_per_call(failures, [&failing, &reported, &update]() -> void {
+		reported += update(failing, delta).has_error() ? 1 : 0;
+	});
+	if(reported != failures) {
+		return std::nullopt;
+	}
+	return std::pair{per_pass, per_failure};
+}
+
+} // namespace
+
+auto main() -> int {
+	const auto legacy = measure<legacy_component, legacy_mover>(legacy_update_all);
+	const auto current = measure<pxe::component, mover>(update_all);
+	if(!legacy || !current) {
+		return EXIT_FAILURE;
+	}
+
+	std::printf("sizeof(result<>): legacy %zu bytes, current %zu bytes\n",
+				sizeof(legacy_result<>),
+				sizeof(pxe::result<>));
+	std::printf("%zu components, update pass: legacy %.1f us, current %.1f us\n",
+				component_count,
+				legacy->first / 1000.0,
+				current->first / 1000.0);
+	std::printf("failing update wrapped in a second error: legacy %.1f ns, current %.1f ns\n",
+				legacy->second,
+				current->second);
+	return EXIT_SUCCESS;
+}
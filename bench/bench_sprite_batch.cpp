@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+// 10k, 50k and 100k sprites from 8 textures over 4 layers, drawn one by one with DrawTexturePro and
+// through a sprite_batch. it needs a GL context, it opens a hidden window, on a machine without a
+// display run it under a virtual one, as with xvfb-run. the optional argument is the size the sprites
+// are drawn at, 64 by default, small sprites leave out most of the fill cost and show the cost of the
+// draw calls
+
+#include "bench.hpp"
+
+#include <pxe/render/sprite_batch.hpp>
+
+#include <raylib.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int screen_width = 1280;
+constexpr int screen_height = 720;
+constexpr std::size_t texture_count = 8;
+constexpr int texture_size = 256;
+constexpr int frames_per_row = 4;
+constexpr float frame_size = 64.0F;
+constexpr float default_sprite_size = 64.0F;
+constexpr int layers = 4;
+constexpr std::size_t warmup_frames = 5;
+constexpr std::size_t frames = 30;
+// quads in the vertex buffer of the default rlgl render batch on desktop
+constexpr std::size_t rlgl_buffer_quads = 8192;
+
+struct sprite {
+	std::size_t texture;
+	Rectangle source;
+	Rectangle dest;
+	int layer;
+};
+
+struct frame_times {
+	double submit_ms{0.0};
+	double frame_ms{0.0};
+};
+
+[[nodiscard]] auto make_sprites(const std::size_t count, const float size, std::mt19937 &random)
+	-> std::vector<sprite> {
+	std::uniform_int_distribution<std::size_t> texture{0, texture_count - 1};
+	std::uniform_int_distribution frame{0, (frames_per_row * frames_per_row) - 1};
+	std::uniform_real_distribution x{-size, static_cast<float>(screen_width)};
+	std::uniform_real_distribution y{-size, static_cast<float>(screen_height)};
+	std::uniform_int_distribution layer{0, layers - 1};
+
+	std::vector<sprite> sprites(count);
+	for(auto &item: sprites) {
+		const auto index = frame(random);
+		item = sprite{
+			.texture = texture(random),
+			.source = {.x = static_cast<float>(index % frames_per_row) * frame_size,
+					   .y = static_cast<float>(index / frames_per_row) * frame_size,
+					   .width = frame_size,
+					   .height = frame_size},
+			.dest = {.x = x(random), .y = y(random), .width = size, .height = size},
+			.layer = layer(random),
+		};
+	}
+	return sprites;
+}
+
+// rlgl starts a draw call when the texture changes and when its vertex buffer is full
+[[nodiscard]] auto count_immediate_draw_calls(const std::vector<sprite> &sprites) -> std::size_t {
+	std::size_t draw_calls = 0;
+	std::size_t buffered = 0;
+	auto current = texture_count;
+	for(const auto &item: sprites) {
+		if(buffered == rlgl_buffer_quads) {
+			buffered = 0;
+			++draw_calls;
+		} else if(item.texture != current) {
+			++draw_calls;
+		}
+		current = item.texture;
+		++buffered;
+	}
+	return draw_calls;
+}
+
+// submit is timed on its own, the frame also takes in the last flush and the buffer swap
+template<typename Submit>
+[[nodiscard]] auto measure(Submit &&submit) -> frame_times {
+	frame_times total;
+	for(std::size_t frame = 0; frame < warmup_frames + frames; ++frame) {
+		BeginDrawing();
+		ClearBackground(BLACK);
+		const auto start = pxe::bench::clock::now();
+		submit();
+		const auto submitted = pxe::bench::clock::now();
+		EndDrawing();
+		const auto ended = pxe::bench::clock::now();
+		if(frame >= warmup_frames) {
+			total.submit_ms += std::chrono::duration<double, std::milli>(submitted - start).count();
+			total.frame_ms += std::chrono::duration<double, std::milli>(ended - start).count();
+		}
+	}
+	return {.submit_ms = total.submit_ms / frames, .frame_ms = total.frame_ms / frames};
+}
+
+} // namespace
+
+auto main(const int argc, char *argv[]) -> int {
+	const auto size = argc > 1 ? std::strtof(argv[1], nullptr) : default_sprite_size; // NOLINT(*-pointer-arithmetic)
+	if(size <= 0.0F) {
+		std::fputs("usage: bench_sprite_batch [sprite size in pixels]\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	SetTraceLogLevel(LOG_WARNING);
+	SetConfigFlags(FLAG_WINDOW_HIDDEN);
+	InitWindow(screen_width, screen_height, "pxe sprite batch benchmark");
+	if(!IsWindowReady()) {
+		std::fputs("failed to open a window for the GL context\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	std::vector<Texture2D> textures;
+	for(std::size_t i = 0; i < texture_count; ++i) {
+		const auto shade = static_cast<unsigned char>(64 + (i * 24));
+		const auto inverse = static_cast<unsigned char>(255 - shade);
+		const auto image = GenImageChecked(
+			texture_size, texture_size, 8, 8, Color{shade, 32, inverse, 255}, Color{32, shade, 96, 255});
+		textures.push_back(LoadTextureFromImage(image));
+		UnloadImage(image);
+	}
+
+	std::mt19937 random{7}; // NOLINT(cert-msc32-c, cert-msc51-cpp)
+	pxe::sprite_batch batch;
+	for(const std::size_t count: {10000, 50000, 100000}) {
+		const auto sprites = make_sprites(count, size, random);
+
+		const auto immediate = measure([&sprites, &textures]() -> void {
+			for(const auto &[texture, source, dest, layer]: sprites) {
+				DrawTexturePro(textures[texture], source, dest, Vector2{}, 0.0F, WHITE);
+			}
+		});
+		std::printf("%6zu sprites, immediate:    %6zu draw calls, submit %7.3f ms, frame %7.3f ms\n",
+					count,
+					count_immediate_draw_calls(sprites),
+					immediate.submit_ms,
+					immediate.frame_ms);
+
+		const auto batched = measure([&sprites, &textures, &batch]() -> void {
+			batch.begin();
+			for(const auto &[texture, source, dest, layer]: sprites) {
+				batch.add(textures[texture], source, dest, WHITE, layer);
+			}
+			batch.end();
+		});
+		std::printf("%6zu sprites, sprite_batch: %6zu draw calls, submit %7.3f ms, frame %7.3f ms\n",
+					count,
+					batch.get_stats().draw_calls,
+					batched.submit_ms,
+					batched.frame_ms);
+	}
+
+	for(const auto &texture: textures) {
+		UnloadTexture(texture);
+	}
+	CloseWindow();
+	return EXIT_SUCCESS;
+}
@@ -3,24 +3,34 @@
 
 #pragma once
 
+#include <pxe/command_buffer.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/event_recording.hpp>
 #include <pxe/events.hpp>
+#include <pxe/job_system.hpp>
+#include <pxe/render/asset_loader.hpp>
 #include <pxe/render/sprite_sheet.hpp>
 #include <pxe/render/texture.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
 #include <pxe/settings.hpp>
+#include <pxe/tick_scheduler.hpp>
 #include <pxe/types.hpp>
 
 #include <raylib.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdarg>
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <spdlog/spdlog.h>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -29,6 +39,16 @@ namespace pxe {
 
 class sprite_sheet;
 
+namespace detail {
+
+template<typename T>
+struct is_optional: std::false_type {};
+
+template<typename T>
+struct is_optional<std::optional<T>>: std::true_type {};
+
+} // namespace detail
+
 class app {
 public:
 	explicit app(
@@ -70,30 +90,205 @@ public:
 	}
 
 	// Event System
-	template<typename Event>
-	auto subscribe(std::function<result<>(const Event &)> handler) -> int {
-		return event_bus_.subscribe<Event>(std::move(handler));
+	template<typename Event, typename Handler>
+	auto subscribe(Handler &&handler) -> event_token {
+		return event_bus_.subscribe<Event>(std::forward<Handler>(handler));
+	}
+
+	// pre-registers event types so they get contiguous ids and their storage up front
+	template<typename... Events>
+	auto register_events() -> void {
+		event_bus_.register_events(event_list<Events...>{});
 	}
 
 	template<typename Event, typename T, typename Func>
-	[[nodiscard]] auto bind_event(T *instance, Func func) -> int {
+	[[nodiscard]] auto bind_event(T *instance, Func func) -> event_token {
 		return subscribe<Event>([instance, func](const Event &evt) -> result<> { return (instance->*func)(evt); });
 	}
 
 	template<typename Event, typename T, typename Func>
-	[[nodiscard]] auto on_event(T *instance, Func func) -> int {
+	[[nodiscard]] auto on_event(T *instance, Func func) -> event_token {
 		return subscribe<Event>([instance, func](const Event &) -> result<> { return (instance->*func)(); });
 	}
 
-	auto unsubscribe(const int token) -> void {
+	auto unsubscribe(const event_token token) -> void {
 		event_bus_.unsubscribe(token);
 	}
 
+	// subscriptions added to the group are removed when it is cleared or destroyed
+	[[nodiscard]] auto create_subscription_group() -> subscription_group {
+		return subscription_group{event_bus_};
+	}
+
+	// during a parallel update the event is posted once the update is over, in scene order
 	template<typename Event>
 	auto post_event(const Event &event) -> void {
+		if(auto *deferred = command_buffer::current(); deferred != nullptr) {
+			deferred->record([this, event]() -> void { event_bus_.post(event); });
+			return;
+		}
 		event_bus_.post(event);
 	}
 
+	// the handler runs on a worker thread with a copy of the event, so it must not touch scenes or
+	// components. when it returns an event, or an engaged std::optional of one, that event is
+	// posted back and dispatched on the main thread
+	template<typename Event, typename Handler>
+	auto subscribe_async(Handler handler) -> event_token {
+		return subscribe<Event>([this, handler = std::move(handler)](const Event &evt) -> result<> {
+			jobs_.submit([this, handler, evt]() mutable -> void {
+				using output = std::invoke_result_t<Handler &, const Event &>;
+				if constexpr(std::is_void_v<output>) {
+					handler(evt);
+				} else if constexpr(detail::is_optional<output>::value) {
+					if(auto out = handler(evt); out) {
+						post_event_from_any_thread(std::move(*out));
+					}
+				} else {
+					post_event_from_any_thread(handler(evt));
+				}
+			});
+			return true;
+		});
+	}
+
+	// records the serializable events of this session, see event_bus::start_recording
+	[[nodiscard]] auto start_event_recording(const std::filesystem::path &path) -> result<> {
+		return event_bus_.start_recording(path);
+	}
+
+	[[nodiscard]] auto stop_event_recording() -> result<> {
+		return event_bus_.stop_recording();
+	}
+
+	// feeds a recorded session back frame by frame, recorded types need to be registered with
+	// register_events, the built-in ones already are
+	[[nodiscard]] auto start_event_replay(const std::filesystem::path &path) -> result<> {
+		return event_bus_.start_replay(path);
+	}
+
+	auto stop_event_replay() -> void {
+		event_bus_.stop_replay();
+	}
+
+	[[nodiscard]] auto is_replaying_events() const -> bool {
+		return event_bus_.is_replaying();
+	}
+
+	// only the last event of this type posted in a frame is dispatched
+	template<typename Event>
+	auto set_event_coalescing() -> void {
+		event_bus_.set_coalescing<Event>();
+	}
+
+	// only the last event per key posted in a frame is dispatched
+	template<typename Event, typename Key_Func>
+	auto set_event_coalescing(Key_Func key) -> void {
+		event_bus_.set_coalescing<Event>(std::move(key));
+	}
+
+	// for worker threads and audio callbacks, the event is dispatched on the main thread by update()
+	template<typename Event>
+	auto post_event_from_any_thread(Event event) -> void {
+		event_bus_.post_from_any_thread(std::move(event));
+	}
+
+	// Fixed Timestep
+	// scenes also get fixed_update tick_rate times per second of game time, at most max_steps times in
+	// one frame, time beyond that is dropped so a slow frame does not make the next ones slower
+	auto enable_fixed_timestep(float tick_rate = 60.0F, int max_steps = 5) -> void;
+
+	auto disable_fixed_timestep() -> void {
+		fixed_timestep_ = false;
+		accumulator_ = 0.0F;
+	}
+
+	[[nodiscard]] auto is_fixed_timestep() const -> bool {
+		return fixed_timestep_;
+	}
+
+	[[nodiscard]] auto get_fixed_step() const -> float {
+		return fixed_step_;
+	}
+
+	// how far this frame is between the last fixed update and the next one, from 0 to 1, to blend the
+	// previous and current simulation state when drawing. 1 when fixed timestep is off
+	[[nodiscard]] auto get_interpolation_alpha() const -> float {
+		return fixed_timestep_ ? accumulator_ / fixed_step_ : 1.0F;
+	}
+
+	// Jobs
+	// worker threads started by init, zero means one less than the hardware threads
+	auto set_worker_count(const std::size_t workers) -> void {
+		worker_count_ = workers;
+	}
+
+	[[nodiscard]] auto get_jobs() -> job_system & {
+		return jobs_;
+	}
+
+	// runs the command now, or after the parallel update when called from a task of it
+	auto defer(std::function<void()> command) -> void {
+		if(auto *deferred = command_buffer::current(); deferred != nullptr) {
+			deferred->record(std::move(command));
+			return;
+		}
+		command();
+	}
+
+	// visible scenes that are thread safe update in parallel on the job system, then the others on the
+	// main thread, then the work they deferred runs in scene order
+	auto set_parallel_scene_update(const bool parallel) -> void {
+		parallel_scene_update_ = parallel;
+	}
+
+	// Update Scheduling
+	// time per frame the low priority scene and component updates that are due can take, the others
+	// wait for a later frame but never longer than the max delay. zero runs all of them
+	auto set_update_budget(const tick_scheduler::clock::duration budget, const float max_delay = 0.25F) -> void {
+		tick_scheduler_.set_budget(budget);
+		tick_scheduler_.set_max_delay(max_delay);
+	}
+
+	[[nodiscard]] auto get_update_stats() const -> const tick_scheduler::frame_stats & {
+		return tick_scheduler_.get_stats();
+	}
+
+	// Scene Transitions
+	using transition_clock = std::chrono::steady_clock;
+
+	// wall time of each stage of the last transition, the time each step getting the destination ready
+	// took, one step per frame, and the most time the transition took out of a single frame
+	struct transition_timing {
+		transition_clock::duration fade_out{};
+		transition_clock::duration wait{};
+		transition_clock::duration fade_in{};
+		transition_clock::duration reset{};
+		transition_clock::duration layout{};
+		transition_clock::duration prepare_draw{};
+		transition_clock::duration swap{};
+		transition_clock::duration longest_frame{};
+	};
+
+	// of the running transition while there is one
+	[[nodiscard]] auto get_transition_timing() const -> const transition_timing & {
+		return transition_timing_;
+	}
+
+	// Headless Replay
+	// wall time of one replayed frame, update is the whole app update including the dispatch
+	struct replay_frame_timing {
+		transition_clock::duration update{};
+		transition_clock::duration dispatch{};
+	};
+
+	// runs the app without drawing, feeding a recorded session at a fixed frame time until it is over,
+	// then ends it and returns the timing of each frame. raylib still needs a gl context for fonts and
+	// textures so the window is created hidden. clicks are replayed by component id, and ids are given
+	// in creation order from a fresh process, so replay with the same build and from a fresh start
+	[[nodiscard]] auto run_replay(const std::filesystem::path &path, float frame_time = 1.0F / 60.0F)
+		-> result<std::vector<replay_frame_timing>>;
+
 	// Audio Management - Music
 	[[nodiscard]] auto play_music(const std::string &path, float volume = 1.0F) -> result<>;
 	[[nodiscard]] auto stop_music() -> result<>;
@@ -155,6 +350,35 @@ public:
 	[[nodiscard]] auto get_sprite_pivot(const std::string &sprite_sheet, const std::string &frame) const
 		-> result<Vector2>;
 
+	// Asset Loading
+	// loads the sprite sheet in the background, a scene transition stays on the black screen until the
+	// sheets requested before it got there are loaded
+	auto request_sprite_sheet(const std::string &name, const std::string &path) -> void;
+
+	// keeps the sheet loaded when the scenes that declared it hibernate, for a sheet shared with a scene
+	// that is only created later and would otherwise load it again
+	auto pin_sprite_sheet(const std::string &name) -> void {
+		++sprite_sheet_users_[name];
+	}
+
+	[[nodiscard]] auto is_sprite_sheet_loaded(const std::string &name) const -> bool {
+		return sprite_sheets_.contains(name);
+	}
+
+	// to draw by frame handle, or into a sprite_batch, without a lookup per sprite. null when the
+	// sheet is not loaded, valid until it is unloaded
+	[[nodiscard]] auto get_sprite_sheet(const std::string &name) const -> const sprite_sheet * {
+		const auto it = sprite_sheets_.find(name);
+		return it == sprite_sheets_.end() ? nullptr : &it->second;
+	}
+
+	// sprite sheets loaded and scenes initialized out of the ones requested and registered
+	[[nodiscard]] auto get_loading_progress() const -> loading_progress;
+
+	[[nodiscard]] auto is_loading() const -> bool {
+		return !get_loading_progress().is_complete();
+	}
+
 	// Display Settings
 	auto toggle_fullscreen() -> bool;
 	auto set_fullscreen(bool fullscreen) -> void;
@@ -242,20 +466,27 @@ protected:
 	}
 
 	// Scene Registration
+	// a visible scene is created and initialized at start up, a hidden one the first time it is shown
+	// or a scene is replaced with it
 	template<typename T>
 		requires std::is_base_of_v<scene, T>
 	auto register_scene(int layer = 0, const bool visible = true) -> scene_id {
 		auto id = ++last_scene_id_;
-		const auto type_name = get_type_name<T>();
+		const auto &type_name = get_type_name<T>();
 
 		SPDLOG_DEBUG("registering scene of type `{}` with id {} at layer {}", type_name, id, layer);
 
-		const auto scene_info_ptr = std::make_shared<scene_info>(
-			scene_info{.id = id, .type_name = type_name, .scene_ptr = std::make_unique<T>(), .layer = layer});
-		scenes_.push_back(scene_info_ptr);
-
-		scene_info_ptr->scene_ptr->set_visible(visible);
-		sort_scenes();
+		const auto scene_info_ptr = std::make_shared<scene_info>(scene_info{
+			.id = id,
+			.type_name = type_name,
+			.scene_ptr = nullptr,
+			.layer = layer,
+			.factory = []() -> std::unique_ptr<scene> { return std::make_unique<T>(); }});
+		if(visible) {
+			wake_scene(*scene_info_ptr);
+			scene_info_ptr->scene_ptr->set_visible(true);
+		}
+		insert_scene(scene_info_ptr);
 
 		return id;
 	}
@@ -267,6 +498,19 @@ protected:
 	}
 
 	[[nodiscard]] auto unregister_scene(scene_id id) -> result<>;
+
+	// a scene that hibernates and stays hidden for the hibernation delay is ended and destroyed,
+	// releasing its components and the sprite sheets no other scene declared. showing it, or replacing
+	// a scene with it, creates and initializes it again. state set on the scene outside of init is lost
+	[[nodiscard]] auto set_scene_hibernation(scene_id id, bool hibernate = true) -> result<>;
+
+	auto set_hibernation_delay(const float seconds) -> void {
+		hibernation_delay_ = seconds;
+	}
+
+	// how often a visible scene updates, see set_update_budget for low priority scenes. fixed_update
+	// and draw are not affected
+	[[nodiscard]] auto set_scene_tick_rate(scene_id id, tick_rate rate) -> result<>;
 	[[nodiscard]] auto show_scene(scene_id id, bool show = true) -> result<>;
 	[[nodiscard]] auto pause_scene(scene_id id) -> result<>;
 	[[nodiscard]] auto resume_scene(scene_id id) -> result<>;
@@ -328,24 +572,79 @@ private:
 	// =============================================================================
 	event_bus event_bus_;
 
+	// =============================================================================
+	// Jobs
+	// =============================================================================
+	job_system jobs_;
+	std::size_t worker_count_{0};
+	// filled by the scenes every frame after they update, runs before anything is drawn
+	task_graph frame_tasks_;
+
+	[[nodiscard]] auto run_frame_tasks() -> result<>;
+
+	// =============================================================================
+	// Fixed Timestep
+	// =============================================================================
+	bool fixed_timestep_{false};
+	float fixed_step_{1.0F / 60.0F};
+	int max_fixed_steps_{5};
+	float accumulator_{0.0F};
+
+	[[nodiscard]] auto run_fixed_steps(float delta) -> result<>;
+
+	bool parallel_scene_update_{false};
+	std::vector<command_buffer> scene_commands_;
+	std::vector<std::unique_ptr<error>> scene_errors_;
+
+	[[nodiscard]] auto update_scenes_in_parallel() -> result<>;
+
+	tick_scheduler tick_scheduler_;
+	// delta each scene updates with this frame, negative for the ones not updating or low priority
+	std::vector<float> scene_deltas_;
+	std::vector<tick_scheduler::due_update> due_scenes_;
+
 	// =============================================================================
 	// Scene Management
 	// =============================================================================
+	// scene_ptr is null until the scene is needed and again once it hibernates
 	struct scene_info {
 		scene_id id;
 		std::string type_name;
 		std::unique_ptr<scene> scene_ptr{nullptr};
 		int layer{};
+		std::function<std::unique_ptr<scene>()> factory{};
+		bool assets_requested{false};
+		bool initialized{false};
+		asset_list assets{};
+		bool hibernates{false};
+		// shown before it was initialized, show is called once it is
+		bool show_pending{false};
+		// the screen changed while it was hidden, it is laid out when shown
+		bool layout_pending{false};
+		float hidden_time{0.0F};
+		tick_timer tick{};
+
+		// only scenes that are initialized and visible update and draw
+		[[nodiscard]] auto is_active() const -> bool {
+			return initialized && scene_ptr->is_visible();
+		}
 	};
 
 	enum class transition_stage : std::int8_t { none, fade_out, wait, fade_in };
 
+	// work getting the destination ready before it is shown, reset only when the scene resets itself
+	enum class transition_step : std::int8_t { reset, layout, prepare_draw, done };
+
 	struct scene_transition {
 		bool active{false};
 		transition_stage stage{transition_stage::none};
 		float timer{0.0F};
 		scene_id from_scene{0};
 		scene_id to_scene{0};
+		transition_step next_step{transition_step::done};
+		transition_clock::time_point stage_start{};
+		// the destination was not initialized when the transition started, it is paused once it is
+		bool pause_pending{false};
 	};
 
 	std::vector<std::shared_ptr<scene_info>> scenes_;
@@ -362,27 +661,36 @@ private:
 	static constexpr float wait_duration = 0.1F;
 	static constexpr float fade_in_duration = 0.3F;
 	scene_transition transition_;
+	transition_timing transition_timing_;
 
-	int version_click_{0};
-	int options_click_{0};
-	int options_closed_{0};
-	int license_accepted_{0};
-	int go_to_game_{0};
-	int back_to_menu_{0};
-	int show_about_{0};
-	int about_back_clicked_{0};
-	int banner_finished_{0};
+	subscription_group builtin_subscriptions_;
 
 	[[nodiscard]] auto find_scene_info(scene_id id) -> result<std::shared_ptr<scene_info>>;
-	auto sort_scenes() -> void;
+	auto insert_scene(std::shared_ptr<scene_info> info) -> void;
 	[[nodiscard]] auto end_all_scenes() -> result<>;
-	[[nodiscard]] auto update_all_scenes(float delta) const -> result<>;
+	[[nodiscard]] auto update_all_scenes(float delta) -> result<>;
 	[[nodiscard]] auto draw_all_scenes() const -> result<>;
 	[[nodiscard]] auto layout_all_scenes() const -> result<>;
-	[[nodiscard]] auto reload_scene(scene_id id) -> result<>;
+	[[nodiscard]] auto update_scene_loading() -> result<>;
+	auto request_scene_assets(scene_info &info) -> void;
+	[[nodiscard]] auto are_scene_assets_loaded(const scene_info &info) const -> bool;
+	[[nodiscard]] auto init_scene(scene_info &info) -> result<>;
+	[[nodiscard]] auto layout_scene(scene_info &info) const -> result<>;
+
+	float hibernation_delay_{30.0F};
+
+	[[nodiscard]] auto update_scene_hibernation(float delta) -> result<>;
+	[[nodiscard]] auto hibernate_scene(scene_info &info) -> result<>;
+	auto wake_scene(scene_info &info) -> void;
+	[[nodiscard]] auto release_scene_assets(const scene_info &info) -> result<>;
+	[[nodiscard]] auto is_in_transition(scene_id id) const -> bool {
+		return transition_.active && (transition_.from_scene == id || transition_.to_scene == id);
+	}
 
 	auto start_scene_transition(scene_id from_scene, scene_id to_scene) -> void;
 	auto update_scene_transition(float delta) -> void;
+	auto enter_transition_stage(transition_stage stage) -> void;
+	auto run_transition_step() -> void;
 	auto handle_fade_out_stage(bool is_reset) -> void;
 	auto handle_wait_stage(bool is_reset) -> void;
 	auto handle_fade_in_stage() -> void;
@@ -424,6 +732,12 @@ private:
 	// Sprite Management
 	// =============================================================================
 	std::unordered_map<std::string, sprite_sheet> sprite_sheets_;
+	asset_loader asset_loader_;
+	// scenes that declared each sheet plus its pins, a sheet is unloaded when the last of them hibernates
+	// or is unregistered
+	std::unordered_map<std::string, std::size_t> sprite_sheet_users_;
+	// textures created per frame, uploading a big batch at once would stall that frame
+	static constexpr std::size_t max_uploads_per_frame = 2;
 
 	[[nodiscard]] auto cleanup_sprite_sheets() -> result<>;
 
@@ -480,6 +794,10 @@ private:
 	bool full_screen_{false};
 #endif
 	bool should_exit_{false};
+	// set by run_replay, the window is hidden, nothing is drawn and frames take replay_frame_time_
+	bool headless_{false};
+	float replay_frame_time_{0.0F};
+	transition_clock::duration last_dispatch_{};
 
 	[[nodiscard]] auto init_window() const -> result<>;
 	[[nodiscard]] auto handle_escape_key() -> result<>;
@@ -508,8 +826,14 @@ private:
 	// =============================================================================
 	// Main Loop
 	// =============================================================================
+	[[nodiscard]] auto prepare_run() -> result<>;
 	[[nodiscard]] auto main_loop() -> result<>;
 	auto configure_gui_for_input_mode() const -> void;
 };
 
+template<>
+struct event_serializer<app::back_to_menu_from>: trivial_event_serializer<app::back_to_menu_from> {
+	static constexpr std::string_view name = "pxe::app::back_to_menu_from";
+};
+
 } // namespace pxe
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace pxe {
+
+// work recorded by a task of a parallel phase that has to run on the main thread, it runs in the order
+// it was recorded once the phase is over
+class command_buffer {
+public:
+	command_buffer() = default;
+	~command_buffer() = default;
+
+	// Non-copyable
+	command_buffer(const command_buffer &) = delete;
+	auto operator=(const command_buffer &) -> command_buffer & = delete;
+
+	// Movable
+	command_buffer(command_buffer &&) noexcept = default;
+	auto operator=(command_buffer &&) noexcept -> command_buffer & = default;
+
+	auto record(std::function<void()> command) -> void {
+		commands_.push_back(std::move(command));
+	}
+
+	// runs the commands, or hands them to the buffer current on this thread when the phase is nested
+	// in another parallel phase, and leaves the buffer empty
+	auto flush() -> void;
+
+	[[nodiscard]] auto size() const -> std::size_t {
+		return commands_.size();
+	}
+
+	// buffer of the parallel task running on this thread, null outside of a parallel phase
+	[[nodiscard]] static auto current() -> command_buffer *;
+
+	// makes a buffer current on this thread while it lives
+	class scope {
+	public:
+		explicit scope(command_buffer &buffer);
+		~scope();
+
+		// Non-copyable
+		scope(const scope &) = delete;
+		auto operator=(const scope &) -> scope & = delete;
+
+		// Non-movable
+		scope(scope &&) noexcept = delete;
+		auto operator=(scope &&) noexcept -> scope & = delete;
+
+	private:
+		command_buffer *previous_;
+	};
+
+private:
+	std::vector<std::function<void()>> commands_;
+};
+
+} // namespace pxe
@@ -5,12 +5,14 @@
 
 #include <pxe/components/button.hpp>
 #include <pxe/components/ui_component.hpp>
+#include <pxe/event_recording.hpp>
 #include <pxe/result.hpp>
 
 #include <raylib.h>
 
 #include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -76,4 +78,9 @@ private:
 	[[nodiscard]] auto send_event() -> result<>;
 };
 
+template<>
+struct event_serializer<audio_slider::audio_slider_changed>: trivial_event_serializer<audio_slider::audio_slider_changed> {
+	static constexpr std::string_view name = "pxe::audio_slider::audio_slider_changed";
+};
+
 } // namespace pxe
\ No newline at end of file
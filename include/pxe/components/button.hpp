@@ -6,11 +6,13 @@
 #include <pxe/app.hpp>
 #include <pxe/components/component.hpp>
 #include <pxe/components/ui_component.hpp>
+#include <pxe/event_recording.hpp>
 #include <pxe/result.hpp>
 
 #include <cstddef>
 #include <format>
 #include <string>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -71,4 +73,11 @@ private:
 	horizontal_alignment horizontal_alignment_{horizontal_alignment::right};
 };
 
+// the id is the component id, given in creation order, a recorded click only finds the same button when
+// it is replayed on the same build from a fresh start
+template<>
+struct event_serializer<button::click>: trivial_event_serializer<button::click> {
+	static constexpr std::string_view name = "pxe::button::click";
+};
+
 } // namespace pxe
\ No newline at end of file
@@ -5,10 +5,12 @@
 
 #include <pxe/components/button.hpp>
 #include <pxe/components/ui_component.hpp>
+#include <pxe/event_recording.hpp>
 #include <pxe/result.hpp>
 
 #include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -50,4 +52,9 @@ private:
 	[[nodiscard]] auto send_event() -> result<>;
 };
 
+template<>
+struct event_serializer<checkbox::checkbox_changed>: trivial_event_serializer<checkbox::checkbox_changed> {
+	static constexpr std::string_view name = "pxe::checkbox::checkbox_changed";
+};
+
 } // namespace pxe
\ No newline at end of file
@@ -11,11 +11,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <optional>
 
 namespace pxe {
 
 class app;
+class scene;
 
 struct size {
 	float width{};
@@ -42,12 +44,58 @@ public:
 		return true;
 	}
 
+	// with the app in fixed timestep mode, called zero or more times per frame before update, always
+	// with the same step
+	[[nodiscard]] virtual auto fixed_update(float /*step*/) -> result<> {
+		return true;
+	}
+
 	[[nodiscard]] virtual auto draw() -> result<> {
 		return true;
 	}
 
+	// true when update only touches the component own state, so a scene with parallel update on may
+	// run it on a worker thread. post_event and app::defer are fine there, other app calls are not.
+	// moving, resizing, showing, enabling or waking the component itself is fine too, the scene gets
+	// the change once the parallel phase is over. doing that to other components is not
+	[[nodiscard]] virtual auto is_thread_safe() const -> bool {
+		return false;
+	}
+
+	// true when update has nothing to do until something changes, the scene puts the component to
+	// sleep after such an update and stops updating it until it is woken. by default whatever set_idle
+	// said, so a component only sleeps when whoever creates it knows it does nothing on its own
+	[[nodiscard]] virtual auto is_idle() const -> bool {
+		return idle_;
+	}
+
+	auto set_idle(const bool idle) -> void {
+		if(idle_ != idle) {
+			idle_ = idle;
+			wake();
+		}
+	}
+
+	// stops updating after the current update until woken, a component in a scene is woken by wake,
+	// by a change of its position, size, visibility or enabled state and by the mouse moving or
+	// clicking inside its bounds. fixed_update and draw still run while it sleeps
+	auto sleep() -> void {
+		sleep_request_ = std::numeric_limits<float>::infinity();
+	}
+
+	// as sleep, waking on its own after the given seconds of scene updates at the latest
+	auto sleep_for(const float seconds) -> void {
+		sleep_request_ = seconds;
+	}
+
+	// safe on a worker thread only for the component being updated there
+	auto wake() -> void;
+
+	[[nodiscard]] auto is_sleeping() const -> bool;
+
 	virtual auto set_position(const Vector2 &pos) -> void {
 		pos_ = pos;
+		bounds_changed();
 	}
 
 	[[nodiscard]] auto get_position() const -> const Vector2 & {
@@ -56,6 +104,7 @@ public:
 
 	auto set_size(const size &size) -> void {
 		size_ = size;
+		bounds_changed();
 	}
 
 	[[nodiscard]] virtual auto get_size() const -> const size & {
@@ -66,12 +115,25 @@ public:
 		return CheckCollisionPointRec(point, {.x = pos.x, .y = pos.y, .width = size.width, .height = size.height});
 	}
 
+	// area the component covers on screen, used for hit testing and by the scene to find it
+	[[nodiscard]] virtual auto get_bounds() const -> Rectangle {
+		const auto &[width, height] = get_size();
+		return {.x = pos_.x, .y = pos_.y, .width = width, .height = height};
+	}
+
 	[[nodiscard]] virtual auto point_inside(const Vector2 point) const -> bool {
-		return point_inside(pos_, size_, point);
+		return CheckCollisionPointRec(point, get_bounds());
 	}
 
+	// true when the component is the one under the mouse, the topmost its scene picked through
+	// scene::pick on its last update. a component outside of a scene tests its own bounds
+	[[nodiscard]] auto is_picked() const -> bool;
+
 	auto set_visible(const bool visible) -> void {
-		visible_ = visible;
+		if(visible_ != visible) {
+			visible_ = visible;
+			wake();
+		}
 	}
 
 	[[nodiscard]] auto is_visible() const -> bool {
@@ -87,7 +149,10 @@ public:
 	}
 
 	auto set_enabled(const bool enabled) -> void {
-		enabled_ = enabled;
+		if(enabled_ != enabled) {
+			enabled_ = enabled;
+			wake();
+		}
 	}
 
 protected:
@@ -101,12 +166,45 @@ protected:
 		return app_->get();
 	}
 
+	// components that change their bounds other than through set_position or set_size call this
+	auto bounds_changed() -> void {
+		if(owner_.owner != nullptr) {
+			notify_owner();
+		}
+	}
+
 private:
+	friend class scene;
+
+	// scene holding the component and its slot there, copies of a component are not held by it
+	struct owner_link {
+		scene *owner{nullptr};
+		std::uint32_t slot{0};
+
+		owner_link() = default;
+		~owner_link() = default;
+		owner_link(const owner_link & /*other*/) noexcept {}
+		auto operator=(const owner_link & /*other*/) noexcept -> owner_link & {
+			return *this;
+		}
+		owner_link(owner_link && /*other*/) noexcept {}
+		auto operator=(owner_link && /*other*/) noexcept -> owner_link & {
+			return *this;
+		}
+	};
+
+	owner_link owner_;
+	auto notify_owner() -> void;
+
+	// seconds to sleep for once the current update ends, infinite until woken
+	std::optional<float> sleep_request_;
+
 	std::optional<std::reference_wrapper<app>> app_;
 	Vector2 pos_{};
 	size size_{};
 	bool visible_ = true;
 	bool enabled_ = true;
+	bool idle_ = false;
 	size_t id_{0};
 	static size_t next_id;
 };
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace pxe {
+
+namespace detail {
+
+// fixed size blocks carved out of chunks that grow geometrically, freed blocks go to an intrusive free
+// list and are handed out again before a new chunk is allocated, memory is never given back.
+// not thread safe, components are created and destroyed on the main thread
+class block_pool {
+public:
+	block_pool(std::size_t block_size, std::size_t block_align);
+	~block_pool() = default;
+
+	// Non-copyable
+	block_pool(const block_pool &) = delete;
+	auto operator=(const block_pool &) -> block_pool & = delete;
+
+	// Non-movable
+	block_pool(block_pool &&) noexcept = delete;
+	auto operator=(block_pool &&) noexcept -> block_pool & = delete;
+
+	[[nodiscard]] auto allocate() -> void *;
+	auto deallocate(void *block) noexcept -> void;
+
+	[[nodiscard]] auto get_capacity() const -> std::size_t {
+		return capacity_;
+	}
+
+	[[nodiscard]] auto get_in_use() const -> std::size_t {
+		return in_use_;
+	}
+
+private:
+	struct free_block {
+		free_block *next;
+	};
+
+	static constexpr std::size_t first_chunk_blocks = 32;
+	static constexpr std::size_t max_chunk_blocks = 1024;
+
+	std::size_t block_size_;
+	std::size_t block_align_;
+	std::size_t next_chunk_blocks_{first_chunk_blocks};
+	std::vector<void *> chunks_;
+	free_block *free_{nullptr};
+	std::size_t capacity_{0};
+	std::size_t in_use_{0};
+
+	auto grow() -> void;
+};
+
+} // namespace detail
+
+// allocator for std::allocate_shared, the control block and the component share one pooled block,
+// so components of the same type end up next to each other and churn does not reach the heap.
+// every type the allocator is rebound to has a pool of its own, allocate_shared rebinds it to a
+// control block type that only that component type uses, so each component type gets its own pool
+template<typename T>
+class pool_allocator {
+public:
+	using value_type = T;
+
+	pool_allocator() noexcept = default;
+
+	template<typename U>
+	// NOLINTNEXTLINE(google-explicit-constructor)
+	pool_allocator(const pool_allocator<U> & /*other*/) noexcept {}
+
+	[[nodiscard]] auto allocate(const std::size_t count) -> T * {
+		if(count != 1) {
+			return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+		}
+		return static_cast<T *>(get_pool().allocate());
+	}
+
+	auto deallocate(T *ptr, const std::size_t count) noexcept -> void {
+		if(count != 1) {
+			::operator delete(ptr, std::align_val_t{alignof(T)});
+			return;
+		}
+		get_pool().deallocate(ptr);
+	}
+
+	// intentionally never destroyed, so components released during static destruction still have a pool
+	// to return to
+	[[nodiscard]] static auto get_pool() -> detail::block_pool & {
+		static auto *pool = new detail::block_pool(block_size, block_align); // NOLINT(cppcoreguidelines-owning-memory)
+		return *pool;
+	}
+
+	template<typename U>
+	friend auto operator==(const pool_allocator & /*a*/, const pool_allocator<U> & /*b*/) noexcept -> bool {
+		return true;
+	}
+
+private:
+	static constexpr std::size_t block_align = std::max(alignof(T), alignof(void *));
+	static constexpr std::size_t block_size = (std::max(sizeof(T), sizeof(void *)) + block_align - 1) / block_align
+											  * block_align;
+};
+
+} // namespace pxe
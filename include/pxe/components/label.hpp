@@ -31,6 +31,11 @@ public:
 	[[nodiscard]] auto end() -> result<> override;
 
 	[[nodiscard]] auto update(float delta) -> result<> override;
+
+	// a focussed label has to check if it loses the focus, even when set idle
+	[[nodiscard]] auto is_idle() const -> bool override {
+		return ui_component::is_idle() && !is_focussed();
+	}
 	[[nodiscard]] auto draw() -> result<> override;
 
 	auto set_text(const std::string &text) -> void;
@@ -11,6 +11,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,9 @@ public:
 							Color hover_color = WHITE,
 							float gap = 0.0F) -> result<>;
 	auto set_position(const Vector2 &pos) -> void override;
+
+	// the area covered by the buttons
+	[[nodiscard]] auto get_bounds() const -> Rectangle override;
 	[[nodiscard]] auto end() -> result<> override;
 	[[nodiscard]] auto update(float delta) -> result<> override;
 	[[nodiscard]] auto draw() -> result<> override;
@@ -50,9 +54,13 @@ private:
 	auto recalculate() -> void;
 	auto recalculate_size() -> void;
 
+	// index of the button containing the point
+	[[nodiscard]] auto button_at(Vector2 point) const -> std::optional<std::size_t>;
+
 	float gap_{0.0F};
 	std::string sprite_sheet_;
 	std::vector<std::shared_ptr<sprite>> sprites_;
+	std::optional<std::size_t> hovered_;
 
 	Color normal_color_{LIGHTGRAY};
 	Color hover_color_{WHITE};
@@ -47,7 +47,8 @@ public:
 		return scale_;
 	}
 
-	[[nodiscard]] auto point_inside(Vector2 point) const -> bool override;
+	// the position is the pivot of the frame
+	[[nodiscard]] auto get_bounds() const -> Rectangle override;
 
 	auto set_frame_name(const std::string &frame_name) {
 		frame_ = frame_name;
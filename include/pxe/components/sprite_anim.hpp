@@ -32,6 +32,10 @@ public:
 	init(app &app, const std::string &sprite_sheet, const std::string &pattern, int frames, float fps) -> result<>;
 	[[nodiscard]] auto update(float delta) -> result<> override;
 
+	[[nodiscard]] auto is_idle() const -> bool override {
+		return !running_ || !is_visible() || !is_enabled();
+	}
+
 	auto reset() -> result<>;
 
 	auto play() -> void;
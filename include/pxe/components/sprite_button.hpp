@@ -35,6 +35,7 @@ public:
 
 	auto set_scale(const float scale) -> void {
 		sprite_.set_scale(scale);
+		set_size(sprite_.get_size());
 	}
 
 	auto set_controller_button(const int button) -> void {
@@ -55,9 +56,14 @@ public:
 		return sprite_.get_size();
 	}
 
+	[[nodiscard]] auto get_bounds() const -> Rectangle override {
+		return sprite_.get_bounds();
+	}
+
+	// the sprite moves first, so the scene sees the new bounds
 	auto set_position(const Vector2 &pos) -> void override {
-		ui_component::set_position(pos);
 		sprite_.set_position(pos);
+		ui_component::set_position(pos);
 	}
 
 private:
@@ -46,7 +46,10 @@ public:
 	[[nodiscard]] auto play_click_sfx() -> result<>;
 
 	auto set_focussed(const bool focussed) -> void {
-		focussed_ = focussed;
+		if(focussed_ != focussed) {
+			focussed_ = focussed;
+			wake();
+		}
 	}
 
 	[[nodiscard]] auto is_focussed() const -> bool {
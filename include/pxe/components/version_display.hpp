@@ -32,6 +32,11 @@ public:
 	[[nodiscard]] auto end() -> result<> override;
 
 	[[nodiscard]] auto update(float delta) -> result<> override;
+
+	// the mouse entering the bounds wakes it, it stays awake until the mouse leaves
+	[[nodiscard]] auto is_idle() const -> bool override {
+		return !hover_;
+	}
 	[[nodiscard]] auto draw() -> result<> override;
 
 	auto set_font_size(const float &size) -> void override;
@@ -4,9 +4,11 @@
 #pragma once
 
 #include <pxe/components/ui_component.hpp>
+#include <pxe/event_recording.hpp>
 #include <pxe/result.hpp>
 
 #include <string>
+#include <string_view>
 
 namespace pxe {
 
@@ -24,4 +26,9 @@ private:
 	std::string title_;
 };
 
+template<>
+struct event_serializer<window::close>: trivial_event_serializer<window::close> {
+	static constexpr std::string_view name = "pxe::window::close";
+};
+
 } // namespace pxe
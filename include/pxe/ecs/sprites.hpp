@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/ecs/world.hpp>
+#include <pxe/render/sprite_batch.hpp>
+#include <pxe/render/sprite_sheet.hpp>
+#include <pxe/result.hpp>
+
+#include <raylib.h>
+
+namespace pxe::ecs {
+
+struct position {
+	Vector2 value{};
+};
+
+// units per second
+struct velocity {
+	Vector2 value{};
+};
+
+struct sprite {
+	sprite_sheet::frame_handle frame;
+	float scale{1.0F};
+	Color tint{WHITE};
+};
+
+// moves every entity with a position and a velocity
+auto move_system(world &entities, float delta) -> void;
+
+// draws every entity with a position and a sprite from a sheet, stopping at the first failure
+[[nodiscard]] auto draw_sprites(world &entities, const sprite_sheet &sheet) -> result<>;
+
+// as above, added to a batch that has begun, on the given layer
+[[nodiscard]] auto draw_sprites(world &entities, const sprite_sheet &sheet, sprite_batch &batch, int layer = 0)
+	-> result<>;
+
+} // namespace pxe::ecs
@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/result.hpp>
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pxe::ecs {
+
+static constexpr std::size_t max_component_types = 64;
+
+using component_mask = std::bitset<max_component_types>;
+
+// index of the entity record plus the generation of the record when the entity was created, a
+// destroyed entity keeps failing to resolve even when its record is reused
+struct entity {
+	std::uint32_t index{0};
+	std::uint32_t generation{0};
+
+	// true when it was returned by a world, it may still be destroyed
+	[[nodiscard]] auto is_set() const -> bool {
+		return generation != 0;
+	}
+
+	friend auto operator==(const entity &a, const entity &b) -> bool = default;
+};
+
+// components are plain data, they are moved between archetypes with memcpy
+template<typename T>
+concept component_data = std::is_trivially_copyable_v<T> && std::is_same_v<T, std::remove_cvref_t<T>>
+						 && alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+namespace detail {
+
+inline auto next_component_type_id() -> std::size_t {
+	static std::atomic<std::size_t> next{0};
+	return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+template<component_data T>
+auto component_type_id() -> std::size_t {
+	static const auto id = detail::next_component_type_id();
+	assert(id < max_component_types && "too many ecs component types");
+	return id;
+}
+
+// all the entities that have exactly the same set of components, one contiguous column per
+// component so a query walks plain arrays
+class archetype {
+public:
+	archetype(const component_mask &mask, const std::array<std::size_t, max_component_types> &sizes);
+
+	[[nodiscard]] auto get_mask() const -> const component_mask & {
+		return mask_;
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t {
+		return entities_.size();
+	}
+
+	[[nodiscard]] auto get_entities() const -> const std::vector<entity> & {
+		return entities_;
+	}
+
+	template<component_data T>
+	[[nodiscard]] auto get_column() -> T * {
+		auto *found = find_column(component_type_id<T>());
+		assert(found != nullptr && "component is not in this archetype");
+		return std::launder(reinterpret_cast<T *>(found->data.data())); // NOLINT(*-reinterpret-cast)
+	}
+
+	// raw storage of a component for a row, null when the archetype does not have it
+	[[nodiscard]] auto get(std::size_t type, std::uint32_t row) -> std::byte *;
+
+	// appends a zeroed row and returns it
+	auto push(entity owner) -> std::uint32_t;
+
+	// moves the last row into row, returns the entity that was moved, if any
+	auto swap_remove(std::uint32_t row) -> entity;
+
+private:
+	struct column {
+		std::size_t type{0};
+		std::size_t element_size{0};
+		std::vector<std::byte> data;
+	};
+
+	component_mask mask_;
+	std::vector<column> columns_;
+	std::array<std::int8_t, max_component_types> column_index_{};
+	std::vector<entity> entities_;
+
+	[[nodiscard]] auto find_column(const std::size_t type) -> column * {
+		const auto index = column_index_[type];
+		return index < 0 ? nullptr : &columns_[static_cast<std::size_t>(index)];
+	}
+};
+
+// archetype based entity storage, entities are ids and their components live in the column of the
+// archetype matching their set of components. entities can not be created, destroyed or change their
+// components while each is iterating
+class world {
+public:
+	world() = default;
+	~world() = default;
+
+	// Non-copyable
+	world(const world &) = delete;
+	auto operator=(const world &) -> world & = delete;
+
+	// Movable
+	world(world &&) noexcept = default;
+	auto operator=(world &&) noexcept -> world & = default;
+
+	template<component_data... Components>
+	auto create(const Components &...components) -> entity {
+		assert(iterating_ == 0 && "entities can not be created while iterating");
+		component_mask mask;
+		(mask.set(register_type<Components>()), ...);
+		auto &target = get_archetype(mask);
+		const auto created = allocate_entity();
+		auto &record = records_[created.index];
+		record.arch = &target;
+		record.row = target.push(created);
+		(std::memcpy(target.get(component_type_id<Components>(), record.row), &components, sizeof(Components)), ...);
+		return created;
+	}
+
+	[[nodiscard]] auto destroy(entity target) -> result<>;
+
+	[[nodiscard]] auto is_alive(entity target) const -> bool;
+
+	// adds the component, or replaces its value when the entity already has it
+	template<component_data T>
+	[[nodiscard]] auto add(const entity target, const T &value) -> result<> {
+		assert(iterating_ == 0 && "components can not be added while iterating");
+		auto *record = find_record(target);
+		if(record == nullptr) {
+			return error(std::format("stale entity: {}", target.index));
+		}
+		const auto type = register_type<T>();
+		if(!record->arch->get_mask().test(type)) {
+			auto mask = record->arch->get_mask();
+			mask.set(type);
+			move_entity(target, *record, get_archetype(mask));
+		}
+		std::memcpy(record->arch->get(type, record->row), &value, sizeof(T));
+		return true;
+	}
+
+	template<component_data T>
+	[[nodiscard]] auto remove(const entity target) -> result<> {
+		assert(iterating_ == 0 && "components can not be removed while iterating");
+		auto *record = find_record(target);
+		if(record == nullptr) {
+			return error(std::format("stale entity: {}", target.index));
+		}
+		const auto type = register_type<T>();
+		if(!record->arch->get_mask().test(type)) {
+			return error(std::format("entity: {} has no component of type: {}", target.index, type));
+		}
+		auto mask = record->arch->get_mask();
+		mask.reset(type);
+		move_entity(target, *record, get_archetype(mask));
+		return true;
+	}
+
+	template<component_data T>
+	[[nodiscard]] auto has(const entity target) const -> bool {
+		const auto *record = find_record(target);
+		return record != nullptr && record->arch->get_mask().test(component_type_id<T>());
+	}
+
+	// null when the entity is destroyed or does not have the component, valid until the next
+	// structural change
+	template<component_data T>
+	[[nodiscard]] auto get(const entity target) -> T * {
+		const auto *record = find_record(target);
+		if(record == nullptr) {
+			return nullptr;
+		}
+		auto *raw = record->arch->get(component_type_id<T>(), record->row);
+		return raw == nullptr ? nullptr : std::launder(reinterpret_cast<T *>(raw)); // NOLINT(*-reinterpret-cast)
+	}
+
+	// calls func(Components &...) or func(entity, Components &...) for every entity that has all the
+	// components, walking each matching archetype column by column
+	template<component_data... Components, typename Func>
+	auto each(Func &&func) -> void {
+		component_mask wanted;
+		(wanted.set(register_type<Components>()), ...);
+		++iterating_;
+		for(const auto &arch: archetypes_) {
+			if(arch->size() == 0 || (arch->get_mask() & wanted) != wanted) {
+				continue;
+			}
+			const auto count = arch->size();
+			const auto *entities = arch->get_entities().data();
+			[&](Components *...columns) -> void {
+				for(std::size_t row = 0; row < count; ++row) {
+					if constexpr(std::is_invocable_v<Func &, entity, Components &...>) {
+						func(entities[row], columns[row]...);
+					} else {
+						func(columns[row]...);
+					}
+				}
+			}(arch->template get_column<Components>()...);
+		}
+		--iterating_;
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t {
+		return alive_;
+	}
+
+	auto clear() -> void;
+
+private:
+	struct record {
+		archetype *arch{nullptr};
+		std::uint32_t row{0};
+		std::uint32_t generation{1};
+	};
+
+	std::vector<record> records_;
+	std::vector<std::uint32_t> free_records_;
+	std::size_t alive_{0};
+
+	std::vector<std::unique_ptr<archetype>> archetypes_;
+	std::unordered_map<component_mask, archetype *> archetype_by_mask_;
+	std::array<std::size_t, max_component_types> type_sizes_{};
+	int iterating_{0};
+
+	template<component_data T>
+	auto register_type() -> std::size_t {
+		const auto type = component_type_id<T>();
+		type_sizes_[type] = sizeof(T);
+		return type;
+	}
+
+	[[nodiscard]] auto find_record(const entity target) const -> const record * {
+		if(target.index >= records_.size()) {
+			return nullptr;
+		}
+		const auto &found = records_[target.index];
+		return found.generation == target.generation && found.arch != nullptr ? &found : nullptr;
+	}
+
+	[[nodiscard]] auto find_record(const entity target) -> record * {
+		return const_cast<record *>(std::as_const(*this).find_record(target)); // NOLINT(*-const-cast)
+	}
+
+	auto get_archetype(const component_mask &mask) -> archetype &;
+	auto allocate_entity() -> entity;
+	auto remove_row(archetype &arch, std::uint32_t row) -> void;
+	auto move_entity(entity target, record &from, archetype &to) -> void;
+};
+
+} // namespace pxe::ecs
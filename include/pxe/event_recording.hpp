@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/result.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace pxe {
+
+// specialize next to an event type to make it recordable, it needs a unique name plus write and read
+template<typename Event>
+struct event_serializer;
+
+template<typename Event>
+concept serializable_event =
+	requires(const Event &event, std::vector<std::byte> &out, const std::span<const std::byte> in) {
+		{ event_serializer<Event>::name } -> std::convertible_to<std::string_view>;
+		event_serializer<Event>::write(event, out);
+		{ event_serializer<Event>::read(in) } -> std::same_as<result<Event>>;
+	};
+
+// byte copy serializer for trivially copyable events, a specialization only has to add the name
+template<typename Event>
+	requires std::is_trivially_copyable_v<Event> && std::is_default_constructible_v<Event>
+struct trivial_event_serializer {
+	static auto write(const Event &event, std::vector<std::byte> &out) -> void {
+		if constexpr(!std::is_empty_v<Event>) {
+			const auto *bytes = reinterpret_cast<const std::byte *>(&event);
+			out.insert(out.end(), bytes, bytes + sizeof(Event));
+		}
+	}
+
+	[[nodiscard]] static auto read(const std::span<const std::byte> in) -> result<Event> {
+		Event event{};
+		if constexpr(!std::is_empty_v<Event>) {
+			if(in.size() != sizeof(Event)) {
+				return error("recorded event size does not match the event type");
+			}
+			std::memcpy(&event, in.data(), sizeof(Event));
+		}
+		return event;
+	}
+};
+
+// writes posted events to a binary file: a header, then type declarations (id and name) the first
+// time a type is seen, and event records (frame, type, payload size and payload) in posting order.
+// values are written in native byte order, recordings are meant to be replayed on the same platform
+class event_recorder {
+public:
+	[[nodiscard]] auto open(const std::filesystem::path &path) -> result<>;
+	[[nodiscard]] auto close() -> result<>;
+
+	[[nodiscard]] auto is_open() const -> bool {
+		return file_.is_open();
+	}
+
+	// type is the event_type_id of the event, frame the dispatch it is delivered in
+	template<serializable_event Event>
+	auto record(const std::size_t type, const std::uint64_t frame, const Event &event) -> void {
+		const auto local = get_local_type(type, event_serializer<Event>::name);
+		payload_.clear();
+		event_serializer<Event>::write(event, payload_);
+		write_event(frame, local);
+	}
+
+	static constexpr std::uint32_t magic = 0x56455850; // PXEV
+	static constexpr std::uint32_t version = 1;
+	static constexpr std::uint8_t type_record = 1;
+	static constexpr std::uint8_t event_record = 2;
+
+private:
+	std::ofstream file_;
+	// local id plus one per event_type_id, zero when the type was not declared in the file yet
+	std::vector<std::uint32_t> local_types_;
+	std::uint32_t next_local_type_{0};
+	std::vector<std::byte> payload_;
+
+	auto get_local_type(std::size_t type, std::string_view name) -> std::uint32_t;
+	auto write_event(std::uint64_t frame, std::uint32_t local) -> void;
+};
+
+// loads a file written by event_recorder and hands out its events frame by frame
+class event_player {
+public:
+	struct recorded_event {
+		std::uint64_t frame{};
+		std::uint32_t type{};
+		std::span<const std::byte> payload;
+	};
+
+	[[nodiscard]] auto open(const std::filesystem::path &path) -> result<>;
+	auto close() -> void;
+
+	[[nodiscard]] auto is_open() const -> bool {
+		return open_;
+	}
+
+	[[nodiscard]] auto is_finished() const -> bool {
+		return next_ >= events_.size();
+	}
+
+	// names of the recorded types, indexed by recorded_event::type
+	[[nodiscard]] auto get_type_names() const -> const std::vector<std::string> & {
+		return type_names_;
+	}
+
+	// the next recorded event if it belongs to the given frame or an earlier one, otherwise null
+	[[nodiscard]] auto next(const std::uint64_t frame) -> const recorded_event * {
+		if(is_finished() || events_[next_].frame > frame) {
+			return nullptr;
+		}
+		return &events_[next_++];
+	}
+
+private:
+	bool open_{false};
+	std::vector<std::byte> data_;
+	std::vector<std::string> type_names_;
+	std::vector<recorded_event> events_;
+	std::size_t next_{0};
+};
+
+} // namespace pxe
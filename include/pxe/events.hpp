@@ -3,112 +3,693 @@
 
 #pragma once
 
+#include <pxe/event_recording.hpp>
 #include <pxe/result.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
 #include <functional>
-#include <map>
+#include <iterator>
 #include <memory>
-#include <queue>
-#include <typeindex>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace pxe {
 
+namespace detail {
+
+inline auto next_event_type_id() -> std::size_t {
+	static std::atomic<std::size_t> next{0};
+	return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+// type erased event handler, callables up to inline_size bytes (an instance and a member function
+// pointer) are stored in place, calling it is a single indirect call with no std::function hop
+class event_handler {
+public:
+	static constexpr std::size_t inline_size = 4 * sizeof(void *);
+
+	template<typename Event, typename Handler>
+	[[nodiscard]] static auto create(Handler &&handler) -> event_handler {
+		using stored = std::decay_t<Handler>;
+		event_handler created;
+		if constexpr(fits_inline<stored>) {
+			::new(static_cast<void *>(created.storage_)) stored(std::forward<Handler>(handler));
+			created.invoke_ = [](void *storage, const void *payload) -> pxe::result<> {
+				return (*std::launder(static_cast<stored *>(storage)))(*static_cast<const Event *>(payload));
+			};
+			created.manage_ = [](void *dst, void *src) -> void {
+				auto *from = std::launder(static_cast<stored *>(src));
+				if(dst != nullptr) {
+					::new(dst) stored(std::move(*from));
+				}
+				from->~stored();
+			};
+		} else {
+			::new(static_cast<void *>(created.storage_)) stored *(new stored(std::forward<Handler>(handler)));
+			created.invoke_ = [](void *storage, const void *payload) -> pxe::result<> {
+				return (**std::launder(static_cast<stored **>(storage)))(*static_cast<const Event *>(payload));
+			};
+			created.manage_ = [](void *dst, void *src) -> void {
+				auto *from = *std::launder(static_cast<stored **>(src));
+				if(dst != nullptr) {
+					::new(dst) stored *(from);
+				} else {
+					delete from;
+				}
+			};
+		}
+		return created;
+	}
+
+	event_handler() = default;
+	~event_handler() {
+		reset();
+	}
+
+	// Non-copyable
+	event_handler(const event_handler &) = delete;
+	auto operator=(const event_handler &) -> event_handler & = delete;
+
+	// Movable
+	event_handler(event_handler &&other) noexcept {
+		take(other);
+	}
+	auto operator=(event_handler &&other) noexcept -> event_handler & {
+		if(this != &other) {
+			reset();
+			take(other);
+		}
+		return *this;
+	}
+
+	[[nodiscard]] auto operator()(const void *payload) -> result<> {
+		return invoke_(storage_, payload);
+	}
+
+private:
+	template<typename T>
+	static constexpr bool fits_inline = sizeof(T) <= inline_size && alignof(T) <= alignof(std::max_align_t)
+										&& std::is_nothrow_move_constructible_v<T>;
+
+	alignas(std::max_align_t) std::byte storage_[inline_size]{};
+	result<> (*invoke_)(void *, const void *){nullptr};
+	// moves the callable from src into dst and destroys src, destroys only when dst is null
+	void (*manage_)(void *, void *){nullptr};
+
+	auto reset() -> void {
+		if(manage_ != nullptr) {
+			manage_(nullptr, storage_);
+			invoke_ = nullptr;
+			manage_ = nullptr;
+		}
+	}
+
+	auto take(event_handler &other) -> void {
+		if(other.manage_ != nullptr) {
+			other.manage_(storage_, other.storage_);
+			invoke_ = std::exchange(other.invoke_, nullptr);
+			manage_ = std::exchange(other.manage_, nullptr);
+		}
+	}
+};
+
+} // namespace detail
+
+// dense, process-wide id for an event type, used to index the typed event channels
+template<typename Event>
+auto event_type_id() -> std::size_t {
+	static const std::size_t id = detail::next_event_type_id();
+	return id;
+}
+
+// list of event types known up front, see event_bus::register_events
+template<typename... Events>
+struct event_list {};
+
+// identifies a subscription, it carries the event type slot so unsubscribe only looks at that type
+struct event_token {
+	std::size_t type{};
+	int id{0};
+
+	[[nodiscard]] auto valid() const -> bool {
+		return id != 0;
+	}
+};
+
 class event_bus {
 public:
-	template<typename Event>
-	auto subscribe(std::function<result<>(const Event &)> handler) -> int {
-		const auto key = std::type_index(typeid(Event));
-		const int id = ++last_token_;
+	event_bus() = default;
+	~event_bus() {
+		// events posted from other threads that were never dispatched
+		auto *node = remote_head_.exchange(nullptr, std::memory_order_acquire);
+		while(node != nullptr) {
+			delete std::exchange(node, node->next);
+		}
+	}
+
+	// Non-copyable
+	event_bus(const event_bus &) = delete;
+	auto operator=(const event_bus &) -> event_bus & = delete;
 
-		auto wrapper = [wrap_handler = std::move(handler)](const void *evt_ptr) -> auto {
-			return wrap_handler(*static_cast<const Event *>(evt_ptr));
-		};
+	// Non-movable
+	event_bus(event_bus &&) noexcept = delete;
+	auto operator=(event_bus &&) noexcept -> event_bus & = delete;
 
-		subscribers_[key].emplace_back(subscriber{.id = id, .func = std::move(wrapper)});
-		return id;
+	template<typename Event, typename Handler>
+		requires std::is_invocable_r_v<result<>, Handler &, const Event &>
+	auto subscribe(Handler &&handler) -> event_token {
+		const int id = ++last_token_;
+		const auto type = event_type_id<Event>();
+		get_handlers(type).add(
+			subscriber{.id = id, .func = detail::event_handler::create<Event>(std::forward<Handler>(handler))});
+		return {.type = type, .id = id};
 	}
 
-	auto unsubscribe(const int token) -> void {
-		for(auto it = subscribers_.begin(); it != subscribers_.end();) {
-			auto &vec = it->second;
-			std::erase_if(vec, [token](const subscriber &sub) -> bool { return sub.id == token; });
-			if(vec.empty()) {
-				it = subscribers_.erase(it);
-			} else {
-				++it;
-			}
+	// creates the channels and handler lists of the listed events ahead of time, so the first post
+	// or subscribe of those types does not allocate them and their ids are contiguous, serializable
+	// events also become available for replay
+	template<typename... Events>
+	auto register_events(event_list<Events...> /*events*/ = {}) -> void {
+		(register_event<Events>(), ...);
+	}
+
+	auto unsubscribe(const event_token token) -> void {
+		if(!token.valid() || token.type >= handlers_.size() || !handlers_[token.type]) {
+			return;
 		}
+		handlers_[token.type]->remove(token.id);
 	}
 
+	// events are stored by value in a per type channel, once the channel buffers have grown
+	// to the per frame peak posting an event does not allocate
 	template<typename Event>
 	auto post(const Event &event) -> void {
-		// Clangd has trouble with std::static_pointer_cast in this context
-		// however it does not error on compilation, nor on runtime
-		// so we just do an empty statement just for the editor
-#ifdef CLANGD_ACTIVE
-		(void)event; // avoid unused variable warning
-#else
-		auto blob = std::make_shared<Event>(event);
-		queued_.push(queued_item{std::type_index(typeid(Event)), std::static_pointer_cast<void>(blob)});
-#endif
+		queue(event);
+	}
+
+	// opt-in, only the last event of this type posted before a dispatch is delivered
+	template<typename Event>
+	auto set_coalescing() -> void {
+		get_channel<Event>().set_coalescing(nullptr);
+	}
+
+	// opt-in, only the last event per key posted before a dispatch is delivered, a coalesced
+	// event keeps the queue position of the first event with that key
+	template<typename Event, typename Key_Func>
+	auto set_coalescing(Key_Func key) -> void {
+		get_channel<Event>().set_coalescing(std::move(key));
 	}
 
+	// safe to call from any thread, the event is handed over with a lock-free push and moved into
+	// its channel by the next dispatch, after the events posted on the dispatching thread
+	template<typename Event>
+	auto post_from_any_thread(Event event) -> void {
+		auto *node = new remote_event<Event>{std::move(event)};
+		node->next = remote_head_.load(std::memory_order_relaxed);
+		while(!remote_head_.compare_exchange_weak(
+			node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+	}
+
+	// called from a handler it does nothing, the events posted meanwhile are delivered by the next
+	// dispatch, the one running walks lists a nested dispatch would swap under it
 	[[nodiscard]] auto dispatch() -> result<> {
-		std::queue<queued_item> local_queue;
-		{
-			if(queued_.empty()) {
-				return true;
+		if(in_dispatch_) {
+			return true;
+		}
+		drain_remote();
+		if(const auto err = replay_frame().unwrap(); err) {
+			return error("failed to replay recorded events", *err);
+		}
+		if(order_.empty()) {
+			++dispatches_;
+			return true;
+		}
+
+		in_dispatch_ = true;
+		// anything posted while dispatching goes to the pending buffers and is dispatched next time
+		std::swap(order_, dispatching_);
+		for(const auto &chan: channels_) {
+			if(chan) {
+				chan->begin_dispatch();
 			}
-			std::swap(local_queue, queued_);
 		}
 
-		while(!local_queue.empty()) {
-			const auto &[type, payload] = local_queue.front();
-			if(const auto err = dispatch_erased(type, payload.get()).unwrap(); err) {
+		for(auto *chan: dispatching_) {
+			if(const auto err = chan->dispatch_next(*this).unwrap(); err) {
+				end_dispatch();
 				return error("dispatch erased failed", *err);
 			}
-			local_queue.pop();
 		}
+
+		end_dispatch();
+		return true;
+	}
+
+	// records every serializable event posted from now on, stamped with the dispatch that delivers it
+	[[nodiscard]] auto start_recording(const std::filesystem::path &path) -> result<> {
+		if(const auto err = recorder_.open(path).unwrap(); err) {
+			return error("failed to start recording events", *err);
+		}
+		recording_start_ = dispatches_;
+		return true;
+	}
+
+	[[nodiscard]] auto stop_recording() -> result<> {
+		return recorder_.close();
+	}
+
+	[[nodiscard]] auto is_recording() const -> bool {
+		return recorder_.is_open();
+	}
+
+	// posts the recorded events at the same dispatch offsets they were recorded at, every recorded
+	// type has to be registered with register_events. while replaying, live posts of those types
+	// are dropped so events that handlers post in response are not delivered twice
+	[[nodiscard]] auto start_replay(const std::filesystem::path &path) -> result<> {
+		stop_replay();
+		if(const auto err = player_.open(path).unwrap(); err) {
+			return error("failed to start replaying events", *err);
+		}
+		for(const auto &name: player_.get_type_names()) {
+			const auto it = decoders_.find(name);
+			if(it == decoders_.end()) {
+				stop_replay();
+				return error(std::format("recorded event type is not registered: {}", name));
+			}
+			replay_types_.push_back(it->second);
+			if(it->second.type >= replayed_.size()) {
+				replayed_.resize(it->second.type + 1, false);
+			}
+			replayed_[it->second.type] = true;
+		}
+		replay_start_ = dispatches_;
 		return true;
 	}
 
+	auto stop_replay() -> void {
+		player_.close();
+		replay_types_.clear();
+		replayed_.clear();
+	}
+
+	[[nodiscard]] auto is_replaying() const -> bool {
+		return player_.is_open();
+	}
+
 private:
 	struct subscriber {
 		int id{};
-		std::function<result<>(const void *)> func;
+		detail::event_handler func;
+		bool active{true};
 	};
 
-	struct queued_item {
-		std::type_index type;
-		std::shared_ptr<void> payload;
+	// subscribers of one event type, dispatch walks the list in place instead of copying it,
+	// subscribers added while a dispatch is walking it join once the outermost dispatch is done.
+	// ids are handed out in increasing order and entries are only appended, so both vectors stay
+	// sorted by id and can be binary searched. removing only marks the entry inactive, the inactive
+	// ones are dropped together once they are more than half of the list and no dispatch is walking it
+	class handler_list {
+	public:
+		auto add(subscriber &&sub) -> void {
+			if(dispatching_ > 0) {
+				added_.push_back(std::move(sub));
+			} else {
+				subscribers_.push_back(std::move(sub));
+			}
+		}
+
+		auto remove(const int token) -> bool {
+			if(const auto it = find(added_, token); it != added_.end() && it->active) {
+				it->active = false;
+				return true;
+			}
+			const auto it = find(subscribers_, token);
+			if(it == subscribers_.end() || !it->active) {
+				return false;
+			}
+			it->active = false;
+			++removed_;
+			if(dispatching_ == 0) {
+				compact();
+			}
+			return true;
+		}
+
+		[[nodiscard]] auto dispatch(const void *payload) -> result<> {
+			++dispatching_;
+			// subscribers added by a handler are not called for the event being dispatched
+			const auto count = subscribers_.size();
+			for(std::size_t i = 0; i < count; ++i) {
+				if(!subscribers_[i].active) {
+					continue;
+				}
+				if(const auto err = subscribers_[i].func(payload).unwrap(); err) {
+					finish_dispatch();
+					return error("event handler function failed", *err);
+				}
+			}
+			finish_dispatch();
+			return true;
+		}
+
+	private:
+		std::vector<subscriber> subscribers_;
+		std::vector<subscriber> added_;
+		std::size_t dispatching_{0};
+		// inactive entries in subscribers_
+		std::size_t removed_{0};
+
+		[[nodiscard]] static auto find(std::vector<subscriber> &list, const int token)
+			-> std::vector<subscriber>::iterator {
+			const auto it = std::ranges::lower_bound(list, token, {}, &subscriber::id);
+			return it != list.end() && it->id == token ? it : list.end();
+		}
+
+		auto compact() -> void {
+			if(removed_ * 2 <= subscribers_.size()) {
+				return;
+			}
+			std::erase_if(subscribers_, [](const subscriber &sub) -> bool { return !sub.active; });
+			removed_ = 0;
+		}
+
+		auto finish_dispatch() -> void {
+			if(--dispatching_ > 0) {
+				return;
+			}
+			if(!added_.empty()) {
+				for(auto &sub: added_) {
+					if(sub.active) {
+						subscribers_.push_back(std::move(sub));
+					}
+				}
+				added_.clear();
+			}
+			compact();
+		}
 	};
 
-	std::map<std::type_index, std::vector<subscriber>> subscribers_;
-	std::queue<queued_item> queued_;
-	int last_token_{0};
+	class channel_base {
+	public:
+		channel_base() = default;
+		virtual ~channel_base() = default;
+
+		channel_base(const channel_base &) = delete;
+		auto operator=(const channel_base &) -> channel_base & = delete;
+		channel_base(channel_base &&) noexcept = delete;
+		auto operator=(channel_base &&) noexcept -> channel_base & = delete;
+
+		virtual auto begin_dispatch() -> void = 0;
+		[[nodiscard]] virtual auto dispatch_next(event_bus &bus) -> result<> = 0;
+		virtual auto end_dispatch() -> void = 0;
+	};
+
+	template<typename Event>
+	class channel final: public channel_base {
+	public:
+		std::vector<Event> pending;
+		std::vector<Event> dispatching;
+		std::size_t next{0};
+
+		// events already pending are indexed too, a later post replaces the last of them with its key
+		auto set_coalescing(std::function<std::size_t(const Event &)> key) -> void {
+			coalesce_ = true;
+			key_ = std::move(key);
+			pending_keys_.clear();
+			for(std::size_t index = 0; index < pending.size(); ++index) {
+				pending_keys_.insert_or_assign(key_ ? key_(pending[index]) : 0, index);
+			}
+		}
 
-	[[nodiscard]] auto dispatch_erased(const std::type_index &type, const void *payload) -> result<> {
-		std::vector<std::function<result<>(const void *)>> handlers;
-		{
-			const auto it = subscribers_.find(type);
-			if(it == subscribers_.end()) {
+		// returns false when the event replaced a pending one instead of taking a new queue slot
+		template<typename Value>
+		auto push(Value &&event) -> bool {
+			if(!coalesce_) {
+				pending.push_back(std::forward<Value>(event));
 				return true;
 			}
-			handlers.reserve(it->second.size());
-			for(const auto &[event_id, func]: it->second) {
-				handlers.push_back(func);
+			const std::size_t key = key_ ? key_(event) : 0;
+			const auto [it, inserted] = pending_keys_.try_emplace(key, pending.size());
+			if(!inserted) {
+				pending[it->second] = std::forward<Value>(event);
+				return false;
 			}
+			pending.push_back(std::forward<Value>(event));
+			return true;
+		}
+
+		auto begin_dispatch() -> void override {
+			std::swap(pending, dispatching);
+			pending_keys_.clear();
+			next = 0;
+		}
+
+		[[nodiscard]] auto dispatch_next(event_bus &bus) -> result<> override {
+			return bus.dispatch_erased(event_type_id<Event>(), &dispatching[next++]);
+		}
+
+		auto end_dispatch() -> void override {
+			dispatching.clear();
+			next = 0;
+		}
+
+	private:
+		bool coalesce_{false};
+		std::function<std::size_t(const Event &)> key_;
+		// index in pending of the event waiting for the next dispatch by key, the map nodes come from a
+		// pool that keeps them across dispatches, so posting does not allocate at the per frame peak
+		std::pmr::unsynchronized_pool_resource pending_key_nodes_;
+		std::pmr::unordered_map<std::size_t, std::size_t> pending_keys_{&pending_key_nodes_};
+	};
+
+	struct remote_node {
+		remote_node *next{nullptr};
+
+		remote_node() = default;
+		virtual ~remote_node() = default;
+
+		remote_node(const remote_node &) = delete;
+		auto operator=(const remote_node &) -> remote_node & = delete;
+		remote_node(remote_node &&) noexcept = delete;
+		auto operator=(remote_node &&) noexcept -> remote_node & = delete;
+
+		virtual auto enqueue(event_bus &bus) -> void = 0;
+	};
+
+	template<typename Event>
+	struct remote_event final: remote_node {
+		explicit remote_event(Event &&evt): event{std::move(evt)} {}
+
+		Event event;
+
+		auto enqueue(event_bus &bus) -> void override {
+			bus.queue(std::move(event));
+		}
+	};
+
+	struct replay_decoder {
+		std::size_t type{};
+		result<> (*post)(event_bus &, std::span<const std::byte>){nullptr};
+	};
+
+	std::vector<std::unique_ptr<handler_list>> handlers_;
+	std::vector<std::unique_ptr<channel_base>> channels_;
+	std::vector<channel_base *> order_;
+	std::vector<channel_base *> dispatching_;
+	// events posted from other threads, a lock-free stack drained by dispatch
+	std::atomic<remote_node *> remote_head_{nullptr};
+	int last_token_{0};
+
+	std::uint64_t dispatches_{0};
+	bool in_dispatch_{false};
+	event_recorder recorder_;
+	std::uint64_t recording_start_{0};
+	event_player player_;
+	std::uint64_t replay_start_{0};
+	std::unordered_map<std::string, replay_decoder> decoders_;
+	// decoders indexed by the type ids of the recording being replayed
+	std::vector<replay_decoder> replay_types_;
+	// event types whose live posts are dropped while replaying
+	std::vector<bool> replayed_;
+
+	template<typename Event>
+	auto register_event() -> void {
+		get_channel<Event>();
+		get_handlers(event_type_id<Event>());
+		if constexpr(serializable_event<Event>) {
+			decoders_.insert_or_assign(std::string{event_serializer<Event>::name},
+									   replay_decoder{.type = event_type_id<Event>(), .post = &replay_post<Event>});
+		}
+	}
+
+	template<typename Value>
+	auto queue(Value &&event) -> void {
+		using Event = std::remove_cvref_t<Value>;
+		if constexpr(serializable_event<Event>) {
+			const auto type = event_type_id<Event>();
+			if(type < replayed_.size() && replayed_[type]) {
+				return;
+			}
+			if(recorder_.is_open()) {
+				// events posted while dispatching are delivered by the next dispatch
+				recorder_.record(type, dispatches_ + (in_dispatch_ ? 1 : 0) - recording_start_, event);
+			}
+		}
+		auto &chan = get_channel<Event>();
+		if(chan.push(std::forward<Value>(event))) {
+			order_.push_back(&chan);
+		}
+	}
+
+	template<typename Event>
+	[[nodiscard]] static auto replay_post(event_bus &bus, const std::span<const std::byte> payload) -> result<> {
+		auto event = event_serializer<Event>::read(payload);
+		if(event.has_error()) {
+			return error(std::format("failed to read recorded event: {}", event_serializer<Event>::name),
+						 event.get_error());
+		}
+		auto &chan = bus.get_channel<Event>();
+		if(chan.push(event.get_value())) {
+			bus.order_.push_back(&chan);
+		}
+		return true;
+	}
+
+	auto replay_frame() -> result<> {
+		if(!player_.is_open()) {
+			return true;
 		}
-		for(const auto &func: handlers) {
-			if(const auto err = func(payload).unwrap(); err) {
-				return error("event handler function failed", *err);
+		const auto frame = dispatches_ - replay_start_;
+		while(const auto *recorded = player_.next(frame)) {
+			if(const auto err = replay_types_[recorded->type].post(*this, recorded->payload).unwrap(); err) {
+				return error("failed to post recorded event", *err);
 			}
 		}
+		if(player_.is_finished()) {
+			stop_replay();
+		}
 		return true;
 	}
+
+	// the stack gives the remote events newest first, reverse it so they are queued in posting order
+	auto drain_remote() -> void {
+		auto *node = remote_head_.exchange(nullptr, std::memory_order_acquire);
+		remote_node *ordered = nullptr;
+		while(node != nullptr) {
+			auto *next = node->next;
+			node->next = ordered;
+			ordered = node;
+			node = next;
+		}
+		while(ordered != nullptr) {
+			ordered->enqueue(*this);
+			delete std::exchange(ordered, ordered->next);
+		}
+	}
+
+	template<typename Event>
+	auto get_channel() -> channel<Event> & {
+		const auto id = event_type_id<Event>();
+		if(id >= channels_.size()) {
+			channels_.resize(id + 1);
+		}
+		auto &slot = channels_[id];
+		if(!slot) {
+			slot = std::make_unique<channel<Event>>();
+		}
+		return static_cast<channel<Event> &>(*slot);
+	}
+
+	auto end_dispatch() -> void {
+		for(const auto &chan: channels_) {
+			if(chan) {
+				chan->end_dispatch();
+			}
+		}
+		dispatching_.clear();
+		in_dispatch_ = false;
+		++dispatches_;
+	}
+
+	auto get_handlers(const std::size_t type) -> handler_list & {
+		if(type >= handlers_.size()) {
+			handlers_.resize(type + 1);
+		}
+		auto &list = handlers_[type];
+		if(!list) {
+			list = std::make_unique<handler_list>();
+		}
+		return *list;
+	}
+
+	[[nodiscard]] auto dispatch_erased(const std::size_t type, const void *payload) -> result<> {
+		if(type >= handlers_.size() || !handlers_[type]) {
+			return true;
+		}
+		return handlers_[type]->dispatch(payload);
+	}
+};
+
+// owns a set of subscriptions and unsubscribes all of them when cleared or destroyed
+class subscription_group {
+public:
+	subscription_group() = default;
+	explicit subscription_group(event_bus &bus): bus_{&bus} {}
+	~subscription_group() {
+		clear();
+	}
+
+	// Non-copyable
+	subscription_group(const subscription_group &) = delete;
+	auto operator=(const subscription_group &) -> subscription_group & = delete;
+
+	// Movable
+	subscription_group(subscription_group &&other) noexcept
+		: bus_{std::exchange(other.bus_, nullptr)}, tokens_{std::move(other.tokens_)} {
+		other.tokens_.clear();
+	}
+	auto operator=(subscription_group &&other) noexcept -> subscription_group & {
+		if(this != &other) {
+			clear();
+			bus_ = std::exchange(other.bus_, nullptr);
+			tokens_ = std::move(other.tokens_);
+			other.tokens_.clear();
+		}
+		return *this;
+	}
+
+	auto add(const event_token token) -> void {
+		tokens_.push_back(token);
+	}
+
+	auto clear() -> void {
+		if(bus_ != nullptr) {
+			for(const auto &token: tokens_) {
+				bus_->unsubscribe(token);
+			}
+		}
+		tokens_.clear();
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t {
+		return tokens_.size();
+	}
+
+private:
+	event_bus *bus_{nullptr};
+	std::vector<event_token> tokens_;
 };
 
-} // namespace pxe
\ No newline at end of file
+} // namespace pxe
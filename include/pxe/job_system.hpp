@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/result.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace pxe {
+
+class job_system;
+
+// jobs that can be waited on together, continuations run once every job of the group finished and
+// count as jobs of the group, so wait also waits for them
+class task_group {
+public:
+	explicit task_group(job_system &jobs): jobs_{&jobs} {}
+	~task_group() {
+		wait();
+	}
+
+	// Non-copyable
+	task_group(const task_group &) = delete;
+	auto operator=(const task_group &) -> task_group & = delete;
+
+	// Non-movable
+	task_group(task_group &&) noexcept = delete;
+	auto operator=(task_group &&) noexcept -> task_group & = delete;
+
+	auto run(std::function<void()> job) -> void;
+
+	// runs after the jobs of the group, right away when there are none
+	auto then(std::function<void()> continuation) -> void;
+
+	// the calling thread runs queued jobs, of any group, until the group is done
+	auto wait() -> void;
+
+	[[nodiscard]] auto is_done() const -> bool {
+		return pending_.load(std::memory_order_acquire) == 0;
+	}
+
+private:
+	friend class job_system;
+
+	job_system *jobs_;
+	std::atomic<std::size_t> pending_{0};
+	std::mutex mutex_;
+	std::vector<std::function<void()>> continuations_;
+
+	auto finish() -> void;
+};
+
+// work stealing job system, every worker thread owns a deque where it pushes and pops its own jobs
+// from the back while idle workers steal from the front of the others. threads that are not workers,
+// the main thread included, share one more deque and run jobs while they wait on a group. with no
+// workers (emscripten or before init) jobs run inline on the calling thread
+class job_system {
+public:
+	job_system() = default;
+	~job_system();
+
+	// Non-copyable
+	job_system(const job_system &) = delete;
+	auto operator=(const job_system &) -> job_system & = delete;
+
+	// Non-movable
+	job_system(job_system &&) noexcept = delete;
+	auto operator=(job_system &&) noexcept -> job_system & = delete;
+
+	// zero workers means one less than the hardware threads, the main thread takes the last core
+	[[nodiscard]] auto init(std::size_t workers = 0) -> result<>;
+	// runs the jobs still queued and joins the workers
+	auto end() -> void;
+
+	// fire and forget
+	auto submit(std::function<void()> job) -> void {
+		push(std::move(job), nullptr);
+	}
+
+	// calls func(begin, end) over chunks of at most grain items, the calling thread runs the first
+	// chunk and helps with the rest, returns when every chunk is done
+	template<typename Func>
+	auto parallel_for(const std::size_t count, const std::size_t grain, Func &&func) -> void {
+		if(count == 0) {
+			return;
+		}
+		const auto chunk = std::max<std::size_t>(grain, 1);
+		task_group group{*this};
+		for(auto begin = chunk; begin < count; begin += chunk) {
+			group.run([&func, begin, end = std::min(begin + chunk, count)]() -> void { func(begin, end); });
+		}
+		func(std::size_t{0}, std::min(chunk, count));
+		group.wait();
+	}
+
+	// as above with about four chunks per thread
+	template<typename Func>
+	auto parallel_for(const std::size_t count, Func &&func) -> void {
+		const auto chunks = (get_worker_count() + 1) * 4;
+		parallel_for(count, (count + chunks - 1) / chunks, std::forward<Func>(func));
+	}
+
+	// runs one queued job on the calling thread, false when there was none
+	auto run_one() -> bool;
+
+	[[nodiscard]] auto get_worker_count() const -> std::size_t {
+		return threads_.size();
+	}
+
+private:
+	friend class task_group;
+
+	struct job {
+		std::function<void()> work;
+		task_group *group{nullptr};
+	};
+
+	struct job_queue {
+		std::mutex mutex;
+		std::deque<job> jobs;
+	};
+
+	static constexpr std::size_t shared_queue = 0;
+	static constexpr int steal_attempts = 64;
+
+	// queue 0 is shared by the threads that are not workers, worker n owns queue n
+	std::vector<std::unique_ptr<job_queue>> queues_;
+	std::vector<std::thread> threads_;
+	std::atomic<std::size_t> queued_{0};
+	std::atomic<bool> stopping_{false};
+	std::mutex sleep_mutex_;
+	std::condition_variable wake_;
+
+	auto push(std::function<void()> work, task_group *group) -> void;
+	[[nodiscard]] auto pop_or_steal(std::size_t own) -> std::optional<job>;
+	[[nodiscard]] auto get_own_queue() const -> std::size_t;
+	static auto execute(job &next) -> void;
+	auto run_worker(std::size_t index) -> void;
+};
+
+// jobs and the jobs they have to wait for, built again every frame. a job can only depend on jobs
+// added before it, so the graph never has cycles
+class task_graph {
+public:
+	using task_id = std::size_t;
+
+	task_graph() = default;
+	~task_graph() = default;
+
+	// Non-copyable
+	task_graph(const task_graph &) = delete;
+	auto operator=(const task_graph &) -> task_graph & = delete;
+
+	// Non-movable
+	task_graph(task_graph &&) noexcept = delete;
+	auto operator=(task_graph &&) noexcept -> task_graph & = delete;
+
+	auto add(std::function<void()> job, std::initializer_list<task_id> after = {}) -> task_id;
+
+	// runs every job once its dependencies finished, returns when all of them are done
+	auto run(job_system &jobs) -> void;
+
+	auto clear() -> void {
+		nodes_.clear();
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t {
+		return nodes_.size();
+	}
+
+private:
+	struct node {
+		std::function<void()> job;
+		std::vector<task_id> successors;
+		std::size_t dependencies{0};
+		std::atomic<std::size_t> remaining{0};
+	};
+
+	std::deque<node> nodes_;
+
+	auto launch(task_group &group, task_id id) -> void;
+};
+
+} // namespace pxe
@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <exception>
 #include <spdlog/spdlog.h>
+#include <string>
 
 #ifdef _WIN32
 #	include <minwindef.h>
@@ -28,7 +29,8 @@ auto run_app() -> int {
 		if(const auto error = application.run().unwrap(); error) {
 			SPDLOG_ERROR("{}", error->to_string());
 #ifndef __EMSCRIPTEN__
-			boxer::show(error->get_message().c_str(), "Error!", boxer::Style::Error);
+			const std::string message{error->get_message()};
+			boxer::show(message.c_str(), "Error!", boxer::Style::Error);
 #endif
 			return EXIT_FAILURE;
 		}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/job_system.hpp>
+#include <pxe/render/sprite_sheet.hpp>
+#include <pxe/result.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pxe {
+
+// assets a scene needs before it is initialized, see scene::declare_assets
+class asset_list {
+public:
+	struct sprite_sheet_asset {
+		std::string name;
+		std::string path;
+	};
+
+	auto add_sprite_sheet(std::string name, std::string path) -> void {
+		sprite_sheets_.push_back(sprite_sheet_asset{.name = std::move(name), .path = std::move(path)});
+	}
+
+	[[nodiscard]] auto get_sprite_sheets() const -> const std::vector<sprite_sheet_asset> & {
+		return sprite_sheets_;
+	}
+
+private:
+	std::vector<sprite_sheet_asset> sprite_sheets_;
+};
+
+struct loading_progress {
+	std::size_t done{0};
+	std::size_t total{0};
+
+	[[nodiscard]] auto is_complete() const -> bool {
+		return done >= total;
+	}
+
+	// from 0 to 1, 1 when there is nothing to load
+	[[nodiscard]] auto get_ratio() const -> float {
+		return total == 0 ? 1.0F : static_cast<float>(done) / static_cast<float>(total);
+	}
+};
+
+// loads sprite sheets in two stages, the files are read and the images decoded on the job system and
+// the textures are created on the main thread, that owns the gpu context
+class asset_loader {
+public:
+	asset_loader() = default;
+	~asset_loader() = default;
+
+	// Non-copyable
+	asset_loader(const asset_loader &) = delete;
+	auto operator=(const asset_loader &) -> asset_loader & = delete;
+
+	// Non-movable
+	asset_loader(asset_loader &&) noexcept = delete;
+	auto operator=(asset_loader &&) noexcept -> asset_loader & = delete;
+
+	// starts decoding on the job system, does nothing when the sheet is already on its way
+	auto request(const std::string &name, const std::string &path, job_system &jobs) -> void;
+
+	[[nodiscard]] auto is_pending(const std::string &name) const -> bool;
+
+	// uploads at most max_uploads decoded sheets, in the order they were requested, and adds them to
+	// sheets. a sheet that failed to decode fails the call, one already in sheets is dropped
+	[[nodiscard]] auto upload(std::unordered_map<std::string, sprite_sheet> &sheets, std::size_t max_uploads)
+		-> result<>;
+
+	[[nodiscard]] auto is_busy() const -> bool {
+		return !pending_.empty();
+	}
+
+	// sheets uploaded out of the ones requested since the loader was last idle
+	[[nodiscard]] auto get_progress() const -> loading_progress {
+		return loading_progress{.done = uploaded_, .total = requested_};
+	}
+
+	// drops the loads in flight, their images are freed once decoded
+	auto clear() -> void {
+		pending_.clear();
+		requested_ = 0;
+		uploaded_ = 0;
+	}
+
+private:
+	// shared with the decoding job, so the loader can drop it while the job still runs
+	struct pending_load {
+		std::string name;
+		std::string path;
+		sprite_sheet sheet;
+		std::unique_ptr<error> failure;
+		std::atomic<bool> decoded{false};
+
+		pending_load(std::string load_name, std::string load_path)
+			: name{std::move(load_name)}, path{std::move(load_path)} {}
+		~pending_load() {
+			sheet.discard();
+		}
+
+		// Non-copyable
+		pending_load(const pending_load &) = delete;
+		auto operator=(const pending_load &) -> pending_load & = delete;
+
+		// Non-movable
+		pending_load(pending_load &&) noexcept = delete;
+		auto operator=(pending_load &&) noexcept -> pending_load & = delete;
+	};
+
+	std::vector<std::shared_ptr<pending_load>> pending_;
+	std::size_t requested_{0};
+	std::size_t uploaded_{0};
+};
+
+} // namespace pxe
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/components/component.hpp>
+
+#include <raylib.h>
+
+namespace pxe {
+
+// 2d camera looking at a target point that ends up in the center of the viewport. with pixel snapping
+// the target is rounded to whole screen pixels so sprites do not shimmer while the camera moves
+class camera {
+public:
+	auto set_target(const Vector2 &target) -> void {
+		target_ = target;
+	}
+
+	[[nodiscard]] auto get_target() const -> const Vector2 & {
+		return target_;
+	}
+
+	auto move(const Vector2 &delta) -> void {
+		target_.x += delta.x;
+		target_.y += delta.y;
+	}
+
+	// values that are not positive are ignored
+	auto set_zoom(float zoom) -> void;
+
+	[[nodiscard]] auto get_zoom() const -> float {
+		return zoom_;
+	}
+
+	auto set_pixel_snap(const bool pixel_snap) -> void {
+		pixel_snap_ = pixel_snap;
+	}
+
+	[[nodiscard]] auto is_pixel_snap() const -> bool {
+		return pixel_snap_;
+	}
+
+	auto set_viewport_size(const size &viewport) -> void {
+		viewport_ = viewport;
+	}
+
+	[[nodiscard]] auto get_viewport_size() const -> const size & {
+		return viewport_;
+	}
+
+	// world area inside the viewport
+	[[nodiscard]] auto get_view() const -> Rectangle;
+
+	[[nodiscard]] auto to_camera_2d() const -> Camera2D;
+
+	[[nodiscard]] auto screen_to_world(Vector2 point) const -> Vector2;
+
+	[[nodiscard]] auto world_to_screen(Vector2 point) const -> Vector2;
+
+private:
+	Vector2 target_{};
+	float zoom_{1.0F};
+	bool pixel_snap_{true};
+	size viewport_{};
+
+	[[nodiscard]] auto get_snapped_target() const -> Vector2;
+};
+
+} // namespace pxe
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pxe {
+
+// draw order for a set of items, each item has a 64 bit key and the queue is sorted with an lsd
+// radix sort, so sorting is linear in the number of items and items with equal keys keep the order
+// they were pushed in
+class render_queue {
+public:
+	struct entry {
+		std::uint64_t key{};
+		std::uint32_t index{};
+	};
+
+	// layer in the high 32 bits and depth in the low 32 bits, both mapped so that unsigned key order
+	// matches their signed order
+	[[nodiscard]] static auto make_key(int layer, float depth = 0.0F) -> std::uint64_t;
+
+	auto clear() -> void {
+		entries_.clear();
+	}
+
+	auto push(const std::uint64_t key, const std::uint32_t index) -> void {
+		entries_.push_back({.key = key, .index = index});
+	}
+
+	auto sort() -> void;
+
+	[[nodiscard]] auto size() const -> std::size_t {
+		return entries_.size();
+	}
+
+	[[nodiscard]] auto begin() const -> std::vector<entry>::const_iterator {
+		return entries_.begin();
+	}
+
+	[[nodiscard]] auto end() const -> std::vector<entry>::const_iterator {
+		return entries_.end();
+	}
+
+private:
+	std::vector<entry> entries_;
+	std::vector<entry> scratch_;
+};
+
+} // namespace pxe
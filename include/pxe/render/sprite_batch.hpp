@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/render/render_queue.hpp>
+
+#include <raylib.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace pxe {
+
+// sprites added between begin and end are drawn at end, sorted by layer and then by texture, straight
+// into the rlgl vertex buffers, so each texture of a layer costs one draw call instead of one call per
+// sprite. sprites of a layer that share a texture keep the order they were added, sprites with
+// different textures do not, put the ones that overlap on different layers. anything drawn between
+// begin and end without the batch ends up under the sprites, and end has to run inside the same 2d
+// mode, or render texture, the sprites are meant for. collecting and sorting the sprites costs more
+// cpu time than drawing them right away, it pays off when the draw calls cost more than that, which
+// bench_sprite_batch measures on the machine it runs on
+class sprite_batch {
+public:
+	// the last end
+	struct frame_stats {
+		std::size_t sprites{0};
+		std::size_t draw_calls{0};
+	};
+
+	sprite_batch() = default;
+	~sprite_batch() = default;
+
+	// Non-copyable
+	sprite_batch(const sprite_batch &) = delete;
+	auto operator=(const sprite_batch &) -> sprite_batch & = delete;
+
+	// Movable
+	sprite_batch(sprite_batch &&) noexcept = default;
+	auto operator=(sprite_batch &&) noexcept -> sprite_batch & = default;
+
+	auto begin() -> void;
+
+	// source in pixels of the texture, as in DrawTexturePro without rotation
+	auto add(const Texture2D &texture, Rectangle source, Rectangle dest, Color tint, int layer = 0) -> void;
+
+	auto end() -> void;
+
+	[[nodiscard]] auto is_drawing() const -> bool {
+		return drawing_;
+	}
+
+	[[nodiscard]] auto get_stats() const -> const frame_stats & {
+		return stats_;
+	}
+
+private:
+	// texture coordinates normalized when added
+	struct quad {
+		Rectangle dest;
+		float left;
+		float top;
+		float right;
+		float bottom;
+		Color tint;
+		unsigned int texture_id;
+	};
+
+	// quads issued between two checks of the rlgl buffer, well below the smallest default buffer
+	static constexpr std::size_t quads_per_check = 1024;
+
+	std::vector<quad> quads_;
+	render_queue order_;
+	frame_stats stats_;
+	bool drawing_{false};
+
+	static auto emit(const quad &item) -> void;
+};
+
+} // namespace pxe
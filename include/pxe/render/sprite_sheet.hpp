@@ -4,22 +4,32 @@
 #pragma once
 
 #include <pxe/components/component.hpp>
+#include <pxe/render/sprite_batch.hpp>
 #include <pxe/render/texture.hpp>
 #include <pxe/result.hpp>
 
 #include <raylib.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <jsoncons/basic_json.hpp>
 #include <jsoncons/json.hpp>
 #include <string>
 #include <system_error>
 #include <unordered_map>
+#include <vector>
 
 namespace pxe {
 
 class sprite_sheet {
 public:
+	// frame resolved once by name, drawing through it skips the name lookup
+	struct frame_handle {
+		std::uint32_t index{invalid_frame};
+	};
+
+	static constexpr std::uint32_t invalid_frame = UINT32_MAX;
+
 	explicit sprite_sheet() = default;
 	virtual ~sprite_sheet() = default;
 
@@ -33,9 +43,32 @@ public:
 
 	auto init(const std::string &path) -> result<>;
 	auto end() -> result<>;
+
+	// init split in two, load parses the sheet and decodes its image and can run on any thread, upload
+	// creates the texture and has to run on the main thread
+	auto load(const std::string &path) -> result<>;
+	auto upload() -> result<>;
+
+	// frees an image that was loaded and never uploaded
+	auto discard() -> void {
+		texture_.discard();
+	}
 	[[nodiscard]] auto
 	draw(const std::string &name, const Vector2 &pos, const float &scale, const Color &tint = WHITE) const -> result<>;
 
+	[[nodiscard]] auto
+	draw(frame_handle frame, const Vector2 &pos, const float &scale, const Color &tint = WHITE) const -> result<>;
+
+	// added to the batch, drawn when it ends
+	[[nodiscard]] auto draw(sprite_batch &batch,
+							frame_handle frame,
+							const Vector2 &pos,
+							const float &scale,
+							const Color &tint = WHITE,
+							int layer = 0) const -> result<>;
+
+	[[nodiscard]] auto get_frame(const std::string &name) const -> result<frame_handle>;
+
 	[[nodiscard]] auto frame_size(const std::string &name) const -> result<size>;
 
 	[[nodiscard]] auto frame_pivot(const std::string &name) const -> result<Vector2>;
@@ -47,11 +80,14 @@ private:
 	};
 
 	texture texture_;
-	std::unordered_map<std::string, frame> frames_;
+	std::vector<frame> frames_;
+	std::unordered_map<std::string, std::uint32_t> frame_index_;
 
 	auto parse_frames(const jsoncons::json &parser) -> result<>;
 	auto parse_meta(const jsoncons::json &parser, const std::filesystem::path &base_path) -> result<>;
 	auto get_frame_data(const std::string &name) const -> result<frame>;
+	auto draw_frame(const frame &data, const Vector2 &pos, const float &scale, const Color &tint) const -> result<>;
+	static auto get_destination(const frame &data, const Vector2 &pos, const float &scale) -> Rectangle;
 };
 
 } // namespace pxe
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <pxe/components/component.hpp>
+#include <pxe/render/sprite_batch.hpp>
 #include <pxe/result.hpp>
 
 #include <raylib.h>
@@ -30,9 +31,21 @@ public:
 	[[nodiscard]] auto draw(Rectangle origin, Rectangle dest, Color tint, float rotation, Vector2 center) const
 		-> result<>;
 
+	// added to the batch, drawn when it ends
+	[[nodiscard]] auto draw(sprite_batch &batch, Rectangle origin, Rectangle dest, Color tint, int layer) const
+		-> result<>;
+
 	[[nodiscard]] virtual auto init(const std::string &path) -> result<>;
 	[[nodiscard]] virtual auto end() -> result<>;
 
+	// init split in two, load reads and decodes the file and can run on any thread, upload creates the
+	// gpu texture from it and has to run on the main thread
+	[[nodiscard]] auto load(const std::string &path) -> result<>;
+	[[nodiscard]] auto upload() -> result<>;
+
+	// frees an image that was loaded and never uploaded
+	auto discard() -> void;
+
 	[[nodiscard]] auto get_size() const -> size {
 		return size_;
 	}
@@ -40,6 +53,8 @@ public:
 private:
 	size size_{.width = 0, .height = 0};
 	Texture2D texture_{};
+	Image image_{};
+	std::string path_;
 };
 
 } // namespace pxe
\ No newline at end of file
@@ -3,53 +3,75 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstddef>
 #include <format>
+#include <memory>
 #include <optional>
 #include <source_location>
 #include <string>
-#include <variant>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace pxe {
 
+// message of an error cause, string literals are kept as a pointer and only built messages own a string.
+// the array constructor only takes constants, a buffer filled at runtime is copied through the
+// std::string one, a const array that is not a constant does not compile instead of dangling
+class error_message {
+public:
+	template<std::size_t Size>
+	// NOLINTNEXTLINE(google-explicit-constructor, *-avoid-c-arrays)
+	consteval error_message(const char (&literal)[Size]): text_{literal, Size - 1} {}
+
+	template<std::size_t Size>
+	// NOLINTNEXTLINE(google-explicit-constructor, *-avoid-c-arrays)
+	error_message(char (&buffer)[Size]): error_message(std::string{buffer}) {}
+
+	// NOLINTNEXTLINE(google-explicit-constructor)
+	error_message(std::string message)
+		: owned_{std::make_shared<const std::string>(std::move(message))}, text_{*owned_} {}
+
+	[[nodiscard]] auto view() const noexcept -> std::string_view {
+		return text_;
+	}
+
+private:
+	// shared by the copies of a cause, text_ points into it
+	std::shared_ptr<const std::string> owned_;
+	std::string_view text_;
+};
+
 class error {
 public:
-	explicit error(const std::string &message, const std::source_location &location = std::source_location::current())
-		: causes_{cause{.message = message, .location = location}} {}
+	explicit error(error_message message, const std::source_location &location = std::source_location::current())
+		: causes_{cause{.message = std::move(message), .location = location}} {}
 
-	error(const std::string &message,
+	error(error_message message,
 		  const error &other,
 		  const std::source_location &location = std::source_location::current())
-		: causes_{cause{.message = message, .location = location}} {
+		: causes_{cause{.message = std::move(message), .location = location}} {
 		causes_.insert(causes_.end(), other.causes_.begin(), other.causes_.end());
 	}
 
-	error(const std::string &message,
-		  const std::optional<error> &other,
-		  const std::source_location &location = std::source_location::current())
-		: causes_{cause{.message = message, .location = location}} {
-		if(other) {
-			causes_.insert(causes_.end(), other->causes_.begin(), other->causes_.end());
-		}
-	}
-
-	[[nodiscard]] auto get_message() const noexcept -> const std::string & {
-		return causes_.front().message;
+	[[nodiscard]] auto get_message() const noexcept -> std::string_view {
+		return causes_.front().message.view();
 	}
 
 	[[nodiscard]] auto get_location() const noexcept -> const std::source_location & {
 		return causes_.front().location;
 	}
 
+	// formatting is deferred until the error is reported
 	[[nodiscard]] auto to_string() const -> std::string {
 		std::string out;
 		for(size_t i = 0; i < causes_.size(); ++i) {
 			const auto &[message, location] = causes_.at(i);
 			if(i == 0) {
-				out += format_message_with_location(message, location);
+				out += format_message_with_location(message.view(), location);
 			} else {
-				out += "\n  caused by: " + format_message_with_location(message, location);
+				out += "\n  caused by: " + format_message_with_location(message.view(), location);
 			}
 		}
 		return out;
@@ -57,64 +79,99 @@ public:
 
 private:
 	struct cause {
-		std::string message;
+		error_message message;
 		std::source_location location;
 	};
 
-	static auto format_message_with_location(const std::string &msg, const std::source_location &loc) -> std::string {
+	static auto format_message_with_location(const std::string_view msg, const std::source_location &loc)
+		-> std::string {
 		return std::format("{} [{}:{} {}]", msg, loc.file_name(), loc.line(), loc.function_name());
 	}
 
 	std::vector<cause> causes_;
 };
 
+// the value plus an error pointer set only on failure, the value is only constructed on success.
+// unwrap on a temporary moves the error out, on a named result it returns a pointer into it
 template<class Value = bool, class Error = error>
-class result: public std::variant<Value, Error> {
+class result {
 public:
 	// NOLINTNEXTLINE(google-explicit-constructor)
-	result(const Value &value): std::variant<Value, Error>(value) {}
+	result(const Value &value): value_{value} {}
+
+	// NOLINTNEXTLINE(google-explicit-constructor)
+	result(Value &&value): value_{std::move(value)} {}
 
 	// NOLINTNEXTLINE(google-explicit-constructor)
-	result(const Error &error): std::variant<Value, Error>(error) {}
+	result(const Error &error): error_{std::make_unique<Error>(error)} {}
 
-	[[maybe_unused]] auto has_error() const noexcept {
-		return std::holds_alternative<Error>(*this);
+	// NOLINTNEXTLINE(google-explicit-constructor)
+	result(Error &&error): error_{std::make_unique<Error>(std::move(error))} {}
+
+	~result() = default;
+
+	result(const result &other)
+		: value_{other.value_}, error_{other.error_ ? std::make_unique<Error>(*other.error_) : nullptr} {}
+
+	auto operator=(const result &other) -> result & {
+		if(this != &other) {
+			value_ = other.value_;
+			error_ = other.error_ ? std::make_unique<Error>(*other.error_) : nullptr;
+		}
+		return *this;
 	}
 
-	[[maybe_unused]] auto has_value() const noexcept {
-		return std::holds_alternative<Value>(*this);
+	result(result &&) noexcept = default;
+	auto operator=(result &&) noexcept -> result & = default;
+
+	[[maybe_unused]] [[nodiscard]] auto has_error() const noexcept -> bool {
+		return error_ != nullptr;
 	}
 
-	[[maybe_unused]] [[nodiscard]] auto get_error() const noexcept {
-		return std::get<Error>(*this);
+	[[maybe_unused]] [[nodiscard]] auto has_value() const noexcept -> bool {
+		return error_ == nullptr;
 	}
 
-	[[maybe_unused]] [[nodiscard]] auto get_value() const noexcept {
-		return std::get<Value>(*this);
+	[[maybe_unused]] [[nodiscard]] auto get_error() const & noexcept -> const Error & {
+		assert(error_ && "result has no error");
+		return *error_;
 	}
 
-	auto unwrap(Value &value) const noexcept -> std::optional<Error> {
-		if(has_error()) {
-			return std::get<Error>(*this);
-		}
-		value = std::get<Value>(*this);
-		return std::nullopt;
+	[[maybe_unused]] [[nodiscard]] auto get_value() const & noexcept -> const Value & {
+		assert(!error_ && "result has an error, not a value");
+		return *value_;
 	}
 
-	auto unwrap(const Value &value) const noexcept -> std::optional<Error> {
-		if(has_error()) {
-			return std::get<Error>(*this);
+	[[maybe_unused]] [[nodiscard]] auto get_value() && noexcept -> Value {
+		assert(!error_ && "result has an error, not a value");
+		return std::move(*value_);
+	}
+
+	auto unwrap(Value &value) && noexcept -> std::unique_ptr<Error> {
+		if(!error_) {
+			value = std::move(*value_);
 		}
-		value = std::get<Value>(*this);
-		return std::nullopt;
+		return std::move(error_);
 	}
 
-	auto unwrap() const noexcept -> std::optional<Error> {
-		if(has_error()) {
-			return std::get<Error>(*this);
+	auto unwrap(Value &value) const & noexcept -> const Error * {
+		if(!error_) {
+			value = *value_;
 		}
-		return std::nullopt;
+		return error_.get();
+	}
+
+	auto unwrap() && noexcept -> std::unique_ptr<Error> {
+		return std::move(error_);
 	}
+
+	auto unwrap() const & noexcept -> const Error * {
+		return error_.get();
+	}
+
+private:
+	std::optional<Value> value_;
+	std::unique_ptr<Error> error_;
 };
 
-} // namespace pxe
\ No newline at end of file
+} // namespace pxe
@@ -5,10 +5,13 @@
 
 #include <pxe/components/button.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/event_recording.hpp>
+#include <pxe/events.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
 
 #include <cstddef>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -19,13 +22,13 @@ public:
 	about() = default;
 	~about() override = default;
 
-	// Copyable
-	about(const about &) = default;
-	auto operator=(const about &) -> about & = default;
+	// Non-copyable
+	about(const about &) = delete;
+	auto operator=(const about &) -> about & = delete;
 
-	// Movable
-	about(about &&) noexcept = default;
-	auto operator=(about &&) noexcept -> about & = default;
+	// Non-movable
+	about(about &&) noexcept = delete;
+	auto operator=(about &&) noexcept -> about & = delete;
 
 	[[nodiscard]] auto init(app &app) -> result<> override;
 	[[nodiscard]] auto end() -> result<> override;
@@ -38,9 +41,14 @@ private:
 	static constexpr auto about_path = "resources/about/about.txt";
 	size_t scroll_text_{0};
 	size_t back_button_{0};
-	int button_click_{0};
+	event_token button_click_{};
 
 	auto on_button_click(const button::click &evt) -> result<>;
 };
 
+template<>
+struct event_serializer<about::back_clicked>: trivial_event_serializer<about::back_clicked> {
+	static constexpr std::string_view name = "pxe::about::back_clicked";
+};
+
 } // namespace pxe
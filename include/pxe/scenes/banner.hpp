@@ -4,10 +4,15 @@
 #pragma once
 
 #include <pxe/components/component.hpp>
+#include <pxe/event_recording.hpp>
+#include <pxe/render/asset_loader.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
 
+#include <raylib.h>
+
 #include <cstddef>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -17,28 +22,43 @@ public:
 	banner() = default;
 	~banner() override = default;
 
-	// Copyable
-	banner(const banner &) = default;
-	auto operator=(const banner &) -> banner & = default;
+	// Non-copyable
+	banner(const banner &) = delete;
+	auto operator=(const banner &) -> banner & = delete;
 
-	// Movable
-	banner(banner &&) noexcept = default;
-	auto operator=(banner &&) noexcept -> banner & = default;
+	// Non-movable
+	banner(banner &&) noexcept = delete;
+	auto operator=(banner &&) noexcept -> banner & = delete;
 
+	auto declare_assets(asset_list &assets) const -> void override;
 	[[nodiscard]] auto init(app &app) -> result<> override;
 	[[nodiscard]] auto layout(size screen_size) -> result<> override;
 	[[nodiscard]] auto update(float delta) -> result<> override;
+	[[nodiscard]] auto draw() -> result<> override;
 
 	struct finished {};
 
 private:
 	static constexpr auto sprite_sheet_name = "menu";
+	static constexpr auto sprite_sheet_path = "resources/pxe/sprites/menu.json";
 	static constexpr auto logo_frame = "pxe.png";
 
 	static constexpr auto time_to_show = 5.0F;
 	float total_time_{0.0F};
 
 	size_t logo_{0};
+
+	// shown under the logo while the app is still loading, the banner does not finish before that
+	static constexpr auto progress_width = 120.0F;
+	static constexpr auto progress_height = 4.0F;
+	static constexpr auto progress_margin = 10.0F;
+	static constexpr auto progress_color = Color{.r = 0x80, .g = 0x80, .b = 0x80, .a = 0xFF};
+	Vector2 progress_position_{};
+};
+
+template<>
+struct event_serializer<banner::finished>: trivial_event_serializer<banner::finished> {
+	static constexpr std::string_view name = "pxe::banner::finished";
 };
 
 } // namespace pxe
\ No newline at end of file
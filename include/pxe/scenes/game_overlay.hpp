@@ -6,12 +6,15 @@
 #include <pxe/app.hpp>
 #include <pxe/components/button.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/event_recording.hpp>
+#include <pxe/events.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
 
 #include <raylib.h>
 
 #include <cstddef>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -39,9 +42,19 @@ private:
 	static constexpr auto hover = Color{.r = 0xFF, .g = 0xFF, .b = 0xFF, .a = 0xC0};
 	static constexpr auto gap = 5.0F;
 
-	int button_click_{0};
+	event_token button_click_{};
 
 	auto on_button_click(const button::click &evt) -> result<>;
 };
 
+template<>
+struct event_serializer<game_overlay::version_click>: trivial_event_serializer<game_overlay::version_click> {
+	static constexpr std::string_view name = "pxe::game_overlay::version_click";
+};
+
+template<>
+struct event_serializer<game_overlay::options_click>: trivial_event_serializer<game_overlay::options_click> {
+	static constexpr std::string_view name = "pxe::game_overlay::options_click";
+};
+
 } // namespace pxe
@@ -5,10 +5,13 @@
 
 #include <pxe/components/button.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/event_recording.hpp>
+#include <pxe/events.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
 
 #include <cstddef>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -19,13 +22,13 @@ public:
 	license() = default;
 	~license() override = default;
 
-	// Copyable
-	license(const license &) = default;
-	auto operator=(const license &) -> license & = default;
+	// Non-copyable
+	license(const license &) = delete;
+	auto operator=(const license &) -> license & = delete;
 
-	// Movable
-	license(license &&) noexcept = default;
-	auto operator=(license &&) noexcept -> license & = default;
+	// Non-movable
+	license(license &&) noexcept = delete;
+	auto operator=(license &&) noexcept -> license & = delete;
 
 	[[nodiscard]] auto init(app &app) -> result<> override;
 	[[nodiscard]] auto end() -> result<> override;
@@ -38,9 +41,14 @@ private:
 	static constexpr auto license_path = "resources/license/license.txt";
 	size_t scroll_text_{0};
 	size_t accept_button_{0};
-	int button_click_{0};
+	event_token button_click_{};
 
 	auto on_button_click(const button::click &evt) -> result<>;
 };
 
+template<>
+struct event_serializer<license::accepted>: trivial_event_serializer<license::accepted> {
+	static constexpr std::string_view name = "pxe::license::accepted";
+};
+
 } // namespace pxe
@@ -6,10 +6,14 @@
 #include <pxe/app.hpp>
 #include <pxe/components/button.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/event_recording.hpp>
+#include <pxe/events.hpp>
+#include <pxe/render/asset_loader.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
 
 #include <cstddef>
+#include <string_view>
 
 namespace pxe {
 class app;
@@ -20,14 +24,15 @@ public:
 	menu() = default;
 	~menu() override = default;
 
-	// Copyable
-	menu(const menu &) = default;
-	auto operator=(const menu &) -> menu & = default;
+	// Non-copyable
+	menu(const menu &) = delete;
+	auto operator=(const menu &) -> menu & = delete;
 
-	// Movable
-	menu(menu &&) noexcept = default;
-	auto operator=(menu &&) noexcept -> menu & = default;
+	// Non-movable
+	menu(menu &&) noexcept = delete;
+	auto operator=(menu &&) noexcept -> menu & = delete;
 
+	auto declare_assets(asset_list &assets) const -> void override;
 	[[nodiscard]] auto init(app &app) -> result<> override;
 	[[nodiscard]] auto end() -> result<> override;
 
@@ -38,10 +43,10 @@ public:
 
 	auto show() -> result<> override;
 
-private:
 	static constexpr auto sprite_sheet_name = "menu";
 	static constexpr auto sprite_sheet_path = "resources/pxe/sprites/menu.json";
 
+private:
 	size_t title_{0};
 	static constexpr auto large_font_size = 20;
 	static constexpr auto menu_music_path = "resources/music/menu.ogg";
@@ -56,9 +61,19 @@ private:
 	static constexpr auto play_button_size = 80;
 	static constexpr auto other_buttons_size = 80;
 #endif
-	int button_click_{0};
+	event_token button_click_{};
 
 	auto on_button_click(const button::click &evt) -> result<>;
 };
 
+template<>
+struct event_serializer<menu::go_to_game>: trivial_event_serializer<menu::go_to_game> {
+	static constexpr std::string_view name = "pxe::menu::go_to_game";
+};
+
+template<>
+struct event_serializer<menu::show_about>: trivial_event_serializer<menu::show_about> {
+	static constexpr std::string_view name = "pxe::menu::show_about";
+};
+
 } // namespace pxe
\ No newline at end of file
@@ -8,12 +8,16 @@
 #include <pxe/components/button.hpp>
 #include <pxe/components/checkbox.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/components/ui_component.hpp>
+#include <pxe/components/window.hpp>
+#include <pxe/event_recording.hpp>
+#include <pxe/events.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
 
 #include <raylib.h>
 
-#include <cstddef>
+#include <string_view>
 #include <vector>
 
 namespace pxe {
@@ -44,40 +48,44 @@ private:
 
 	static constexpr auto control_row_gap = 5.0F;
 
-	size_t window_ = 0;
-	int close_window_ = 0;
+	subscription_group subscriptions_;
+
+	component_handle<window> window_;
 	auto on_close_window() -> result<>;
 
-	size_t music_slider_{0};
-	size_t sfx_slider_{0};
+	component_handle<audio_slider> music_slider_;
+	component_handle<audio_slider> sfx_slider_;
 
-	int slider_change_{0};
 	auto on_slider_change(const audio_slider::audio_slider_changed &change) -> result<>;
-	[[nodiscard]] auto set_slider_values(size_t slider, float value, bool muted) const -> result<>;
+	[[nodiscard]] auto set_slider_values(component_handle<audio_slider> slider, float value, bool muted) const
+		-> result<>;
 
-	size_t crt_cb_{0};
-	size_t scan_lines_cb_{0};
-	size_t color_bleed_cb_{0};
-	size_t fullscreen_cb_{0};
+	component_handle<checkbox> crt_cb_;
+	component_handle<checkbox> scan_lines_cb_;
+	component_handle<checkbox> color_bleed_cb_;
+	component_handle<checkbox> fullscreen_cb_;
 
-	[[nodiscard]] auto set_checkbox_value(size_t cb, bool value) const -> result<>;
+	[[nodiscard]] auto set_checkbox_value(component_handle<checkbox> cb, bool value) const -> result<>;
 
-	int checkbox_changed_{0};
 	auto on_checkbox_changed(const checkbox::checkbox_changed &change) -> result<>;
 
-	int button_click_{0};
 	auto on_button_click(const button::click &click) -> result<>;
 
-	size_t back_button_{0};
-	size_t quit_button_{0};
+	component_handle<button> back_button_;
+	component_handle<button> quit_button_;
 
-	std::vector<size_t> ui_components_;
+	std::vector<component_handle<ui_component>> ui_components_;
 
-	[[nodiscard]] auto get_focus() const -> result<size_t>;
-	[[nodiscard]] auto set_focus(size_t id) const -> result<>;
-	[[nodiscard]] auto move_focus(size_t focus, direction dir) -> result<>;
+	[[nodiscard]] auto get_focus() const -> result<component_handle<ui_component>>;
+	[[nodiscard]] auto set_focus(component_handle<ui_component> focus) const -> result<>;
+	[[nodiscard]] auto move_focus(component_handle<ui_component> focus, direction dir) -> result<>;
 
 	static constexpr auto click_sound = "click";
 };
 
+template<>
+struct event_serializer<options::options_closed>: trivial_event_serializer<options::options_closed> {
+	static constexpr std::string_view name = "pxe::options::options_closed";
+};
+
 } // namespace pxe
\ No newline at end of file
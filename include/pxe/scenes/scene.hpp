@@ -3,24 +3,79 @@
 
 #pragma once
 
+#include <pxe/command_buffer.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/components/component_pool.hpp>
+#include <pxe/ecs/world.hpp>
+#include <pxe/job_system.hpp>
+#include <pxe/render/asset_loader.hpp>
+#include <pxe/render/camera.hpp>
+#include <pxe/render/render_queue.hpp>
+#include <pxe/scenes/spatial_hash.hpp>
 #include <pxe/result.hpp>
+#include <pxe/tick_scheduler.hpp>
 #include <pxe/types.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <format>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <spdlog/spdlog.h>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace pxe {
 
 class app;
+class scene;
+
+// typed reference to a component registered in a scene, a slot index plus the generation of the slot
+// when the component was added. once the component is removed the handle goes stale, even if the
+// slot is reused, and the scene stops resolving it
+template<typename T>
+class component_handle {
+public:
+	component_handle() = default;
+
+	// a handle to a derived component is also a handle to any of its bases
+	template<typename Derived>
+		requires std::is_base_of_v<T, Derived>
+	// NOLINTNEXTLINE(google-explicit-constructor)
+	component_handle(const component_handle<Derived> &other)
+		: index_{other.index_}, generation_{other.generation_}, id_{other.id_} {}
+
+	// true when it was returned by a scene, it may still be stale
+	[[nodiscard]] auto is_set() const -> bool {
+		return generation_ != 0;
+	}
+
+	// id of the component, the one used in component events
+	[[nodiscard]] auto get_id() const -> size_t {
+		return id_;
+	}
+
+	friend auto operator==(const component_handle &a, const component_handle &b) -> bool = default;
+
+private:
+	template<typename>
+	friend class component_handle;
+	friend class scene;
+
+	component_handle(const std::uint32_t index, const std::uint32_t generation, const size_t id)
+		: index_{index}, generation_{generation}, id_{id} {}
+
+	std::uint32_t index_{0};
+	std::uint32_t generation_{0};
+	size_t id_{0};
+};
 
 struct scene_id {
 	constexpr scene_id() noexcept = default;
@@ -68,12 +123,31 @@ public:
 	struct child {
 		std::shared_ptr<component> comp;
 		int layer = 0;
-		std::string type_name;
+		// from get_type_name, that keeps the name alive
+		std::string_view type_name;
+		std::uint32_t slot = 0;
 	};
+
+	scene() = default;
+	// components that outlive the scene stop reporting to it
+	~scene() override;
+
+	// Non-copyable
+	scene(const scene &) = delete;
+	auto operator=(const scene &) -> scene & = delete;
+
+	// Non-movable, the components point back to the scene
+	scene(scene &&) noexcept = delete;
+	auto operator=(scene &&) noexcept -> scene & = delete;
+
 	[[nodiscard]] auto init(app &app) -> result<> override {
 		return component::init(app);
 	}
 
+	// assets the app loads in the background before calling init, scenes are initialized in order once
+	// their assets are loaded, so init finds them ready and does not block the window
+	virtual auto declare_assets(asset_list & /*assets*/) const -> void {}
+
 	[[nodiscard]] auto end() -> result<> override;
 
 	[[nodiscard]] virtual auto show() -> result<> {
@@ -84,10 +158,19 @@ public:
 		return true;
 	}
 
+	// updates only the components that are awake, see component::sleep
 	[[nodiscard]] auto update(float delta) -> result<> override;
 
+	[[nodiscard]] auto fixed_update(float step) -> result<> override;
+
 	[[nodiscard]] auto draw() -> result<> override;
 
+	// called every frame after update, jobs added to the graph run on the job system and all of them
+	// finish before the frame is drawn
+	[[nodiscard]] virtual auto schedule(task_graph & /*graph*/) -> result<> {
+		return true;
+	}
+
 	[[nodiscard]] virtual auto reset() -> result<> {
 		return true;
 	}
@@ -96,18 +179,34 @@ public:
 		return true;
 	}
 
+	// work of the first draw that can be done ahead, the app calls it while the scene is still hidden
+	// before a transition shows it, the base version sorts the draw order
+	[[nodiscard]] virtual auto prepare_draw() -> result<>;
+
+	// same as register_component, returning a handle for lookups that need no search and no cast
 	template<typename T, typename... Args>
 		requires std::is_base_of_v<component, T>
-	[[nodiscard]] auto register_component(Args &&...args) -> result<size_t> {
-		auto comp = std::make_shared<T>();
-		const auto type_name = get_type_name<T>();
+	[[nodiscard]] auto add_component(Args &&...args) -> result<component_handle<T>> {
+		// pooled per type, the component and its shared_ptr control block share one recycled block
+		auto comp = std::allocate_shared<T>(pool_allocator<T>{});
+		const auto &type_name = get_type_name<T>();
 		if(const auto err = comp->init(get_app(), std::forward<Args>(args)...).unwrap(); err) {
 			return error(std::format("error initializing component of type: {}", type_name), *err);
 		}
 		auto id = comp->get_id(); // save id before moving
-		children_.emplace_back(child{.comp = std::move(comp), .layer = 0, .type_name = type_name});
+		const auto index = insert_child(std::move(comp), type_name);
 		SPDLOG_DEBUG("component of type `{}` registered with id {}", type_name, id);
-		return id;
+		return component_handle<T>{index, slots_[index].generation, id};
+	}
+
+	template<typename T, typename... Args>
+		requires std::is_base_of_v<component, T>
+	[[nodiscard]] auto register_component(Args &&...args) -> result<size_t> {
+		const auto added = add_component<T>(std::forward<Args>(args)...);
+		if(added.has_error()) {
+			return added.get_error();
+		}
+		return added.get_value().get_id();
 	}
 
 	[[nodiscard]] auto remove_component(const size_t id) -> result<> {
@@ -115,15 +214,71 @@ public:
 		if(it == children_.end()) {
 			return error(std::format("no component found with id: {}", id));
 		}
-		if(const auto err = it->comp->end().unwrap(); err) {
-			return error(std::format("error ending component with id: {}", id), *err);
+		return remove_child(it);
+	}
+
+	template<typename T>
+	[[nodiscard]] auto remove_component(const component_handle<T> handle) -> result<> {
+		const auto *found = find_child(handle.index_, handle.generation_);
+		if(found == nullptr) {
+			return error(std::format("stale component handle for id: {}", handle.id_));
+		}
+		return remove_child(children_.begin() + (found - children_.data()));
+	}
+
+	// O(1) and no cast, fails once the component has been removed
+	template<typename T>
+	[[nodiscard]] auto get_component(const component_handle<T> handle) const -> result<std::shared_ptr<T>> {
+		const auto *found = find_child(handle.index_, handle.generation_);
+		if(found == nullptr) {
+			return error(std::format("stale component handle for id: {}", handle.id_));
+		}
+		return std::static_pointer_cast<T>(found->comp);
+	}
+
+	// as get_component without the shared_ptr copy, null once the component has been removed
+	template<typename T>
+	[[nodiscard]] auto get_component_ptr(const component_handle<T> handle) const -> T * {
+		const auto *found = find_child(handle.index_, handle.generation_);
+		return found == nullptr ? nullptr : static_cast<T *>(found->comp.get());
+	}
+
+	template<typename T>
+	[[nodiscard]] auto is_valid(const component_handle<T> handle) const -> bool {
+		return find_child(handle.index_, handle.generation_) != nullptr;
+	}
+
+	// components draw in layer order, components in the same layer in the order they were registered
+	[[nodiscard]] auto set_component_layer(const size_t id, const int layer) -> result<> {
+		const auto it = find_component(id);
+		if(it == children_.end()) {
+			return error(std::format("no component found with id: {}", id));
+		}
+		if(it->layer != layer) {
+			it->layer = layer;
+			render_order_dirty_ = true;
 		}
-		const auto type_name = it->type_name;
-		children_.erase(it);
-		SPDLOG_DEBUG("component with id: {} name: {} removed", id, type_name);
 		return true;
 	}
 
+	// awake components update at their tick rate, with the time since their last update as delta. low
+	// priority ones update on the main thread after the others, when the tick scheduler has time
+	[[nodiscard]] auto set_component_tick_rate(const size_t id, const tick_rate rate) -> result<> {
+		const auto it = slot_by_id_.find(id);
+		if(it == slot_by_id_.end()) {
+			return error(std::format("no component found with id: {}", id));
+		}
+		slots_[it->second].tick.set_rate(rate);
+		return true;
+	}
+
+	// within a layer draw components with a lower y position first, the draw order is rebuilt on the
+	// next draw after a component moves while this is on
+	auto set_y_sort(const bool y_sort) -> void {
+		y_sort_ = y_sort;
+		render_order_dirty_ = true;
+	}
+
 	template<typename T>
 		requires std::is_base_of_v<component, T>
 	[[nodiscard]] auto get_component(const size_t id) const -> result<std::shared_ptr<T>> {
@@ -131,7 +286,7 @@ public:
 		if(it == children_.end()) {
 			return error(std::format("no component found with id: {}", id));
 		}
-		const auto type_name = get_type_name<T>();
+		const auto &type_name = get_type_name<T>();
 		auto comp = std::dynamic_pointer_cast<T>(it->comp);
 		if(!comp) {
 			return error(std::format("component with id: {} is not of type: {}, is: {}", id, type_name, it->type_name));
@@ -155,6 +310,87 @@ public:
 
 	[[nodiscard]] virtual auto resume() -> result<>;
 
+	// topmost enabled and visible component whose bounds contain the point, the one that draws last,
+	// null when there is none. only looks at the components near the point. the point is on screen,
+	// it goes through the camera when the camera is enabled. every update the scene picks the component
+	// under the mouse, the widgets ask for it with component::is_picked instead of testing the mouse
+	[[nodiscard]] auto pick(Vector2 screen_point) const -> component *;
+
+	// when the camera is enabled the scene draws through it and skips the components whose bounds are
+	// outside its view, components drawing outside of their bounds need to override get_bounds
+	[[nodiscard]] auto get_camera() -> camera & {
+		return camera_;
+	}
+
+	[[nodiscard]] auto get_camera() const -> const camera & {
+		return camera_;
+	}
+
+	auto set_camera_enabled(const bool enabled) -> void {
+		camera_enabled_ = enabled;
+	}
+
+	[[nodiscard]] auto is_camera_enabled() const -> bool {
+		return camera_enabled_;
+	}
+
+	// components that are thread safe update in parallel on the job system, then the others on the main
+	// thread in order, then the work they deferred runs in component order
+	auto set_parallel_update(const bool parallel) -> void {
+		parallel_update_ = parallel;
+	}
+
+	// set by the app, without it the scene updates serially
+	auto set_job_system(job_system &jobs) -> void {
+		jobs_ = &jobs;
+	}
+
+	// set by the app, without it every due low priority component updates
+	auto set_tick_scheduler(tick_scheduler &scheduler) -> void {
+		tick_scheduler_ = &scheduler;
+	}
+
+	// size of the area the scene draws into, set by the app
+	auto set_viewport_size(const size &viewport) -> void {
+		camera_.set_viewport_size(viewport);
+	}
+
+	// visible components drawn and skipped by the camera in the last draw
+	struct draw_stats {
+		std::size_t drawn{0};
+		std::size_t culled{0};
+	};
+
+	[[nodiscard]] auto get_draw_stats() const -> const draw_stats & {
+		return draw_stats_;
+	}
+
+	// components the next update runs on
+	[[nodiscard]] auto get_awake_count() const -> std::size_t {
+		return awake_slots_.size();
+	}
+
+	using update_system = std::function<result<>(ecs::world &, float)>;
+	using draw_system = std::function<result<>(ecs::world &)>;
+
+	// entities of the scene, created on first use so scenes that only have components pay nothing
+	[[nodiscard]] auto get_world() -> ecs::world &;
+
+	// update systems run after the components update, draw systems before the components draw, so
+	// entities are drawn under the scene ui, both in the order they were added
+	auto add_update_system(update_system system) -> void {
+		update_systems_.push_back(std::move(system));
+	}
+
+	auto add_draw_system(draw_system system) -> void {
+		draw_systems_.push_back(std::move(system));
+	}
+
+	// fixed systems run after the components fixed update, with the fixed step as delta
+	auto add_fixed_system(update_system system) -> void {
+		fixed_systems_.push_back(std::move(system));
+	}
+
 private:
 	struct paused_component {
 		size_t id;
@@ -164,10 +400,127 @@ private:
 	std::vector<paused_component> paused_components_;
 
 	[[nodiscard]] auto find_component(const size_t id) const -> std::vector<child>::const_iterator {
-		return std::ranges::find_if(children_, [id](const child &c) -> bool { return c.comp->get_id() == id; });
+		const auto it = slot_by_id_.find(id);
+		if(it == slot_by_id_.end()) {
+			return children_.end();
+		}
+		return children_.begin() + slots_[it->second].child;
+	}
+
+	[[nodiscard]] auto find_component(const size_t id) -> std::vector<child>::iterator {
+		const auto it = slot_by_id_.find(id);
+		if(it == slot_by_id_.end()) {
+			return children_.end();
+		}
+		return children_.begin() + slots_[it->second].child;
+	}
+
+	[[nodiscard]] auto find_child(const std::uint32_t index, const std::uint32_t generation) const -> const child * {
+		if(index >= slots_.size() || slots_[index].generation != generation) {
+			return nullptr;
+		}
+		return &children_[slots_[index].child];
 	}
 
+	// children in registration order
 	std::vector<child> children_;
+
+	// slot map over children_, a slot keeps the position of its child and a generation that changes
+	// every time the slot is freed, so handles to removed components can be detected
+	struct slot {
+		std::uint32_t child{0};
+		std::uint32_t generation{1};
+		bool awake{false};
+		tick_timer tick;
+	};
+
+	std::vector<slot> slots_;
+	std::vector<std::uint32_t> free_slots_;
+	// the map nodes come from a pool owned by the scene and are reused, so adding and removing
+	// components does not reach the global allocator once the pool has grown
+	std::pmr::unsynchronized_pool_resource slot_by_id_nodes_;
+	std::pmr::unordered_map<size_t, std::uint32_t> slot_by_id_{&slot_by_id_nodes_};
+
+	auto insert_child(std::shared_ptr<component> comp, std::string_view type_name) -> std::uint32_t;
+	[[nodiscard]] auto remove_child(std::vector<child>::iterator it) -> result<>;
+
+	// indices into children_ in draw order, rebuilt only when the children or their layers change
+	render_queue render_queue_;
+	bool render_order_dirty_{true};
+	bool y_sort_{false};
+
+	auto build_render_queue() -> void;
+
+	camera camera_;
+	bool camera_enabled_{false};
+	draw_stats draw_stats_;
+
+	[[nodiscard]] auto draw_content() -> result<>;
+
+	job_system *jobs_{nullptr};
+	bool parallel_update_{false};
+	std::vector<command_buffer> child_commands_;
+	std::vector<std::unique_ptr<error>> child_errors_;
+
+	[[nodiscard]] auto update_children_in_parallel() -> result<>;
+
+	// slots of the components that are awake, in the order they woke up
+	std::vector<std::uint32_t> awake_slots_;
+
+	struct child_update {
+		std::uint32_t position;
+		float delta;
+	};
+
+	// components updated this frame, the ones due in registration order then the low priority ones
+	std::vector<child_update> updating_;
+	// slots of the low priority components that are due
+	std::vector<tick_scheduler::due_update> due_children_;
+	tick_scheduler *tick_scheduler_{nullptr};
+
+	struct wake_timer {
+		std::uint32_t slot;
+		std::uint32_t generation;
+		float time;
+	};
+
+	// components sleeping for a while, woken once the update clock reaches their time
+	std::vector<wake_timer> wake_timers_;
+	float update_clock_{0.0F};
+	std::optional<Vector2> last_mouse_;
+
+	auto collect_awake_children(float delta) -> void;
+	[[nodiscard]] auto update_low_priority_children() -> result<>;
+	auto sleep_idle_children() -> void;
+	auto wake_children_at(Vector2 screen_point) -> void;
+
+	auto wake_child(std::uint32_t slot) -> void;
+	[[nodiscard]] auto is_child_awake(std::uint32_t slot) const -> bool {
+		return slots_[slot].awake;
+	}
+
+	// slot of the component under the mouse, picked once per update before the components update
+	std::optional<std::uint32_t> picked_slot_;
+
+	[[nodiscard]] auto pick_slot(Vector2 screen_point) const -> std::optional<std::uint32_t>;
+	[[nodiscard]] auto is_child_picked(const std::uint32_t slot) const -> bool {
+		return picked_slot_ == slot;
+	}
+
+	// bounds of the children by slot, kept up to date by the children when they move or resize
+	spatial_hash spatial_hash_;
+
+	// called by the children when they move, resize or wake up. from a task of a parallel update the
+	// change is recorded in the command buffer of the task and reaches the scene once the parallel
+	// phase is over, on the main thread, so workers never touch the scene
+	friend class component;
+	auto child_bounds_changed(std::uint32_t slot) -> void;
+	auto child_woken(std::uint32_t slot) -> void;
+
+	std::unique_ptr<ecs::world> world_;
+	std::vector<update_system> update_systems_;
+	std::vector<update_system> fixed_systems_;
+	std::vector<draw_system> draw_systems_;
 };
 } // namespace pxe
 
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <raylib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace pxe {
+
+// uniform grid of square cells over an unbounded plane, items are small dense ids with a bounding
+// rectangle and a point query only looks at the items overlapping the cell of the point. items that
+// cover too many cells are kept in a list checked by every query instead. emptied cells are kept, so
+// items moving around the same area do not allocate
+class spatial_hash {
+public:
+	static constexpr float default_cell_size = 64.0F;
+	static constexpr int max_cells_per_item = 64;
+
+	explicit spatial_hash(const float cell_size = default_cell_size): cell_size_{cell_size} {}
+
+	// inserts the item or moves it to its new bounds, items with no area are not found by queries
+	auto set(std::uint32_t item, const Rectangle &bounds) -> void;
+
+	auto remove(std::uint32_t item) -> void;
+
+	auto clear() -> void;
+
+	// calls func(item) for every item whose bounds may contain the point, callers test the bounds
+	template<typename Func>
+	auto for_each_at(const Vector2 point, Func &&func) const -> void {
+		if(const auto it = cells_.find(key(cell_of(point.x), cell_of(point.y))); it != cells_.end()) {
+			for(const auto item: it->second) {
+				func(item);
+			}
+		}
+		for(const auto item: oversized_) {
+			func(item);
+		}
+	}
+
+private:
+	struct cell_range {
+		int min_x{0};
+		int min_y{0};
+		int max_x{-1};
+		int max_y{-1};
+
+		[[nodiscard]] auto is_empty() const -> bool {
+			return max_x < min_x || max_y < min_y;
+		}
+
+		[[nodiscard]] auto count() const -> std::int64_t {
+			return is_empty() ? 0 : static_cast<std::int64_t>(max_x - min_x + 1) * (max_y - min_y + 1);
+		}
+
+		friend auto operator==(const cell_range &a, const cell_range &b) -> bool = default;
+	};
+
+	float cell_size_;
+	std::vector<cell_range> items_;
+	std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> cells_;
+	std::vector<std::uint32_t> oversized_;
+
+	[[nodiscard]] auto cell_of(float coordinate) const -> int;
+	[[nodiscard]] auto range_of(const Rectangle &bounds) const -> cell_range;
+
+	[[nodiscard]] static auto key(const int x, const int y) -> std::uint64_t {
+		return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32U) | static_cast<std::uint32_t>(y);
+	}
+
+	[[nodiscard]] static auto is_oversized(const cell_range &range) -> bool {
+		return range.count() > max_cells_per_item;
+	}
+
+	auto link(std::uint32_t item, const cell_range &range) -> void;
+	auto unlink(std::uint32_t item, const cell_range &range) -> void;
+	static auto erase_item(std::vector<std::uint32_t> &items, std::uint32_t item) -> void;
+};
+
+} // namespace pxe
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <pxe/result.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace pxe {
+
+enum class tick_priority : std::uint8_t {
+	normal,
+	low,
+};
+
+// how often something updates, rate times per second or every frame with a rate of zero. low
+// priority updates that are due wait for the tick_scheduler to have time for them
+struct tick_rate {
+	float rate{0.0F};
+	tick_priority priority{tick_priority::normal};
+};
+
+// frame time gathered since the last update, the update gets all of it as its delta
+class tick_timer {
+public:
+	tick_timer() = default;
+	explicit tick_timer(const tick_rate rate): rate_{rate} {}
+
+	auto set_rate(const tick_rate rate) -> void {
+		rate_ = rate;
+	}
+
+	[[nodiscard]] auto get_rate() const -> const tick_rate & {
+		return rate_;
+	}
+
+	[[nodiscard]] auto is_low_priority() const -> bool {
+		return rate_.priority == tick_priority::low;
+	}
+
+	// adds the frame time, true when an update is due
+	auto advance(const float delta) -> bool {
+		elapsed_ += delta;
+		return rate_.rate <= 0.0F || elapsed_ * rate_.rate >= 1.0F;
+	}
+
+	// seconds past the time the update was due
+	[[nodiscard]] auto get_lateness() const -> float {
+		return rate_.rate <= 0.0F ? elapsed_ : elapsed_ - (1.0F / rate_.rate);
+	}
+
+	// delta for the update that is about to run, the timer starts over
+	auto consume() -> float {
+		const auto elapsed = elapsed_;
+		elapsed_ = 0.0F;
+		return elapsed;
+	}
+
+private:
+	tick_rate rate_;
+	float elapsed_{0.0F};
+};
+
+// spreads low priority updates over frames. the due ones run, the latest first, while the time spent
+// on them this frame stays within the budget, the rest wait for a later frame. one later than the max
+// delay runs even without budget, so none of them starves. the budget only applies on the thread that
+// began the frame, runs on any other thread run every due update
+class tick_scheduler {
+public:
+	using clock = std::chrono::steady_clock;
+
+	struct due_update {
+		std::uint32_t index{0};
+		float lateness{0.0F};
+	};
+
+	// low priority updates of the last frame
+	struct frame_stats {
+		std::size_t ran{0};
+		std::size_t deferred{0};
+		clock::duration spent{};
+	};
+
+	tick_scheduler() = default;
+	~tick_scheduler() = default;
+
+	// Non-copyable
+	tick_scheduler(const tick_scheduler &) = delete;
+	auto operator=(const tick_scheduler &) -> tick_scheduler & = delete;
+
+	// Non-movable
+	tick_scheduler(tick_scheduler &&) noexcept = delete;
+	auto operator=(tick_scheduler &&) noexcept -> tick_scheduler & = delete;
+
+	// zero runs every due update
+	auto set_budget(const clock::duration budget) -> void {
+		budget_ = budget;
+	}
+
+	[[nodiscard]] auto get_budget() const -> clock::duration {
+		return budget_;
+	}
+
+	auto set_max_delay(const float seconds) -> void {
+		max_delay_ = seconds;
+	}
+
+	auto begin_frame() -> void;
+
+	// calls update(index) for the due updates that fit in the budget, the deferred ones keep gathering
+	// time and come back the next frame. runs nested in another run share its budget
+	template<typename Func>
+	[[nodiscard]] auto run(std::vector<due_update> &due, Func &&update) -> result<> {
+		const auto tracked = std::this_thread::get_id() == frame_thread_;
+		if(tracked) {
+			std::ranges::sort(due, std::ranges::greater{}, &due_update::lateness);
+			enter();
+		}
+		std::unique_ptr<error> failure;
+		for(const auto &[index, lateness]: due) {
+			if(tracked && lateness < max_delay_ && !has_time()) {
+				++stats_.deferred;
+				continue;
+			}
+			if(failure = std::invoke(update, index).unwrap(); failure) {
+				break;
+			}
+			if(tracked) {
+				++stats_.ran;
+			}
+		}
+		if(tracked) {
+			leave();
+		}
+		if(failure) {
+			return error("failed to run a low priority update", *failure);
+		}
+		return true;
+	}
+
+	[[nodiscard]] auto get_stats() const -> const frame_stats & {
+		return stats_;
+	}
+
+private:
+	clock::duration budget_{};
+	float max_delay_{0.25F};
+	std::thread::id frame_thread_;
+	frame_stats stats_;
+	int depth_{0};
+	clock::time_point run_start_;
+
+	[[nodiscard]] auto has_time() const -> bool;
+	auto enter() -> void;
+	auto leave() -> void;
+};
+
+} // namespace pxe
@@ -13,17 +13,21 @@
 
 namespace pxe {
 
+// demangled on the first call for each type, the name lives until the program ends
 template<typename T>
-static auto get_type_name() -> std::string {
+static auto get_type_name() -> const std::string & {
+	static const std::string name = []() -> std::string {
 #if defined(__GNUG__) && !defined(__EMSCRIPTEN__) && !defined(__APPLE__)
-	int status = 0;
-	const char *mangled = typeid(T).name();
-	using demangle_ptr = std::unique_ptr<char, decltype(&std::free)>;
-	demangle_ptr const demangled{abi::__cxa_demangle(mangled, nullptr, nullptr, &status), &std::free};
-	return (status == 0 && demangled) ? demangled.get() : mangled;
+		int status = 0;
+		const char *mangled = typeid(T).name();
+		using demangle_ptr = std::unique_ptr<char, decltype(&std::free)>;
+		demangle_ptr const demangled{abi::__cxa_demangle(mangled, nullptr, nullptr, &status), &std::free};
+		return (status == 0 && demangled) ? demangled.get() : mangled;
 #else
-	return typeid(T).name();
+		return typeid(T).name();
 #endif
+	}();
+	return name;
 }
 
 } // namespace pxe
\ No newline at end of file
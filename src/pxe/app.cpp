@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: MIT
 
 #include <pxe/app.hpp>
+#include <pxe/components/audio_slider.hpp>
+#include <pxe/components/button.hpp>
+#include <pxe/components/checkbox.hpp>
 #include <pxe/components/component.hpp>
+#include <pxe/components/window.hpp>
 #include <pxe/events.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/about.hpp>
@@ -16,6 +20,8 @@
 #include <raylib.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
@@ -76,8 +82,29 @@ auto app::init() -> result<> {
 		return error("audio device could not be initialized", *err);
 	}
 
+	if(const auto err = jobs_.init(worker_count_).unwrap(); err) {
+		return error("failed to start the job system", *err);
+	}
+
+	register_events<game_overlay::version_click,
+					game_overlay::options_click,
+					options::options_closed,
+					license::accepted,
+					menu::go_to_game,
+					back_to_menu_from,
+					menu::show_about,
+					about::back_clicked,
+					banner::finished,
+					button::click,
+					checkbox::checkbox_changed,
+					audio_slider::audio_slider_changed,
+					window::close>();
 	subscribe_to_builtin_events();
 
+	// sliders post every frame while dragged, only the latest value of each slider matters
+	set_event_coalescing<audio_slider::audio_slider_changed>(
+		[](const audio_slider::audio_slider_changed &change) -> std::size_t { return change.id; });
+
 	SPDLOG_INFO("init application");
 
 	if(const auto err = init_window().unwrap(); err) {
@@ -105,6 +132,14 @@ auto app::end() -> result<> {
 		return pxe::error{"failed to unload click sfx", *err};
 	}
 
+	// async handlers still running may post results, let them finish before the scenes go away
+	jobs_.end();
+	asset_loader_.clear();
+
+	if(const auto err = stop_event_recording().unwrap(); err) {
+		return error("failed to stop recording events", *err);
+	}
+
 	unsubscribe_from_builtin_events();
 
 	if(const auto err = end_all_scenes().unwrap(); err) {
@@ -141,7 +176,7 @@ auto app::end() -> result<> {
 // Lifecycle - Main Loop
 // =============================================================================
 
-auto app::run() -> result<> {
+auto app::prepare_run() -> result<> {
 	if(const auto err = init().unwrap(); err) {
 		return error("error init the application", *err);
 	}
@@ -158,6 +193,14 @@ auto app::run() -> result<> {
 		return error("error init scenes", *err);
 	}
 
+	return true;
+}
+
+auto app::run() -> result<> {
+	if(const auto err = prepare_run().unwrap(); err) {
+		return error("error preparing the application", *err);
+	}
+
 #ifndef __EMSCRIPTEN__
 	set_fullscreen(full_screen_);
 #endif
@@ -198,6 +241,54 @@ auto app::run() -> result<> {
 #endif
 }
 
+auto app::run_replay(const std::filesystem::path &path, const float frame_time)
+	-> result<std::vector<replay_frame_timing>> {
+	headless_ = true;
+	replay_frame_time_ = frame_time;
+
+	if(const auto err = prepare_run().unwrap(); err) {
+		return error("error preparing the application", *err);
+	}
+
+	if(const auto err = start_event_replay(path).unwrap(); err) {
+		return error("error starting the replay", *err);
+	}
+
+	std::vector<replay_frame_timing> frames;
+	replay_frame_timing total;
+	replay_frame_timing longest;
+	while(is_replaying_events() && !should_exit_) {
+		const auto start = transition_clock::now();
+		if(const auto err = update().unwrap(); err) {
+			return error("error updating the application", *err);
+		}
+		const auto &frame = frames.emplace_back(
+			replay_frame_timing{.update = transition_clock::now() - start, .dispatch = last_dispatch_});
+		total.update += frame.update;
+		total.dispatch += frame.dispatch;
+		longest.update = std::max(longest.update, frame.update);
+		longest.dispatch = std::max(longest.dispatch, frame.dispatch);
+	}
+
+	if(const auto err = end().unwrap(); err) {
+		return error("error ending the application", *err);
+	}
+
+	if(!frames.empty()) {
+		using std::chrono::duration_cast;
+		using std::chrono::microseconds;
+		const auto count = static_cast<transition_clock::rep>(frames.size());
+		SPDLOG_INFO("replayed {} frames, update avg {}us max {}us, dispatch avg {}us max {}us",
+					frames.size(),
+					duration_cast<microseconds>(total.update / count).count(),
+					duration_cast<microseconds>(longest.update).count(),
+					duration_cast<microseconds>(total.dispatch / count).count(),
+					duration_cast<microseconds>(longest.dispatch).count());
+	}
+
+	return frames;
+}
+
 auto app::main_loop() -> result<> {
 	configure_gui_for_input_mode();
 
@@ -221,17 +312,38 @@ auto app::update() -> result<> {
 		}
 	}
 
-	const auto delta = GetFrameTime();
+	if(const auto err = update_scene_loading().unwrap(); err) {
+		return error("failed to load scenes", *err);
+	}
+
+	const auto delta = headless_ ? replay_frame_time_ : GetFrameTime();
+
+	if(const auto err = update_scene_hibernation(delta).unwrap(); err) {
+		return error("failed to hibernate scenes", *err);
+	}
 
 	update_scene_transition(delta);
 
+	if(fixed_timestep_) {
+		if(const auto err = run_fixed_steps(delta).unwrap(); err) {
+			return error("failed to run fixed steps", *err);
+		}
+	}
+
+	tick_scheduler_.begin_frame();
 	if(const auto err = update_all_scenes(delta).unwrap(); err) {
 		return error("failed to update scenes", *err);
 	}
 
+	if(const auto err = run_frame_tasks().unwrap(); err) {
+		return error("failed to run frame tasks", *err);
+	}
+
+	const auto dispatch_start = transition_clock::now();
 	if(const auto err = event_bus_.dispatch().unwrap(); err) {
 		return error("error dispatching events", *err);
 	}
+	last_dispatch_ = transition_clock::now() - dispatch_start;
 
 	if(const auto err = handle_escape_key().unwrap(); err) {
 		return error("failed to handle escape key", *err);
@@ -277,20 +389,28 @@ auto app::find_scene_info(const scene_id id) -> result<std::shared_ptr<scene_inf
 	return error(std::format("scene with id {} not found", id));
 }
 
-auto app::sort_scenes() -> void {
-	std::ranges::sort(scenes_,
-					  [](const auto &scene_a, const auto &scene_b) -> bool { return scene_a->layer < scene_b->layer; });
+// scenes stay ordered by layer, a new scene goes after the ones already in its layer
+auto app::insert_scene(std::shared_ptr<scene_info> info) -> void {
+	const auto it = std::ranges::upper_bound(
+		scenes_, info->layer, {}, [](const std::shared_ptr<scene_info> &other) -> int { return other->layer; });
+	scenes_.insert(it, std::move(info));
 }
 
 auto app::unregister_scene(const scene_id id) -> result<> {
 	const auto it = std::ranges::find_if(scenes_, [id](const auto &scene) -> bool { return scene->id == id; });
 	if(it != scenes_.end()) {
-		if((*it)->scene_ptr) {
+		if((*it)->initialized) {
 			if(const auto err = (*it)->scene_ptr->end().unwrap(); err) {
 				return error(std::format("error ending scene with id: {} name: {}", id, (*it)->type_name), *err);
 			}
 			(*it)->scene_ptr.reset(nullptr);
 		}
+		if((*it)->assets_requested) {
+			if(const auto err = release_scene_assets(**it).unwrap(); err) {
+				return error(
+					std::format("failed to release assets of scene with id: {} name: {}", id, (*it)->type_name), *err);
+			}
+		}
 		scenes_.erase(it);
 		return true;
 	}
@@ -303,9 +423,25 @@ auto app::show_scene(const scene_id id, const bool show) -> result<> {
 		return error(std::format("scene with id {} not found", id));
 	}
 
+	if(show) {
+		wake_scene(*info);
+	} else if(!info->scene_ptr) {
+		return true;
+	}
 	info->scene_ptr->set_visible(show);
 
+	if(!info->initialized) {
+		info->show_pending = show;
+		SPDLOG_DEBUG("scene with id: {} name: {} is not initialized, only its visibility changed", id, info->type_name);
+		return true;
+	}
+
 	if(show) {
+		if(info->layout_pending) {
+			if(const auto err = layout_scene(*info).unwrap(); err) {
+				return error(std::format("failed to layout scene with id: {} name: {}", id, info->type_name), *err);
+			}
+		}
 		if(const auto enable_err = info->scene_ptr->show().unwrap(); enable_err) {
 			return error(std::format("failed to show scene with id: {} name: {}", id, info->type_name), *enable_err);
 		}
@@ -326,6 +462,11 @@ auto app::pause_scene(const scene_id id) -> result<> {
 		return error(std::format("scene with id {} not found", id));
 	}
 
+	// a scene not created yet has nothing to pause
+	if(!info->scene_ptr) {
+		return true;
+	}
+
 	if(const auto pause_err = info->scene_ptr->pause().unwrap(); pause_err) {
 		return error(std::format("failed to pause scene with id: {} name: {}", id, info->type_name), *pause_err);
 	}
@@ -340,6 +481,10 @@ auto app::resume_scene(const scene_id id) -> result<> {
 		return error(std::format("scene with id {} not found", id));
 	}
 
+	if(!info->scene_ptr) {
+		return true;
+	}
+
 	if(const auto resume_err = info->scene_ptr->resume().unwrap(); resume_err) {
 		return error(std::format("failed to resume scene with id: {} name: {}", id, info->type_name), *resume_err);
 	}
@@ -353,36 +498,158 @@ auto app::replace_scene(const scene_id current_scene, const scene_id new_scene)
 	return true;
 }
 
-auto app::reload_scene(const scene_id id) -> result<> {
+// =============================================================================
+// Scene Management - Lifecycle
+// =============================================================================
+
+// only requests the assets of the scenes created so far, the visible ones, update_scene_loading
+// initializes them frame by frame once their assets are loaded
+auto app::init_scenes() -> result<> {
+	SPDLOG_INFO("init scenes");
+	for(const auto &info: scenes_) {
+		if(info->scene_ptr) {
+			request_scene_assets(*info);
+		}
+	}
+	return true;
+}
+
+auto app::update_scene_loading() -> result<> {
+	if(const auto err = asset_loader_.upload(sprite_sheets_, max_uploads_per_frame).unwrap(); err) {
+		return error("failed to load assets", *err);
+	}
+
+	// at most one scene per frame, in order, so a scene can use what the ones before it set up
+	for(const auto &info: scenes_) {
+		if(info->initialized || !info->scene_ptr) {
+			continue;
+		}
+		request_scene_assets(*info);
+		if(!are_scene_assets_loaded(*info)) {
+			return true;
+		}
+		return init_scene(*info);
+	}
+	return true;
+}
+
+auto app::request_scene_assets(scene_info &info) -> void {
+	if(info.assets_requested) {
+		return;
+	}
+	info.scene_ptr->declare_assets(info.assets);
+	info.assets_requested = true;
+	for(const auto &[name, path]: info.assets.get_sprite_sheets()) {
+		++sprite_sheet_users_[name];
+		request_sprite_sheet(name, path);
+	}
+}
+
+auto app::are_scene_assets_loaded(const scene_info &info) const -> bool {
+	return std::ranges::all_of(info.assets.get_sprite_sheets(),
+							   [this](const auto &sheet) -> bool { return sprite_sheets_.contains(sheet.name); });
+}
+
+auto app::init_scene(scene_info &info) -> result<> {
+	if(const auto err = info.scene_ptr->init(*this).unwrap(); err) {
+		return error(std::format("failed to initialize scene with id: {} name: {}", info.id, info.type_name), *err);
+	}
+	info.initialized = true;
+
+	if(transition_.active && transition_.pause_pending && transition_.to_scene == info.id) {
+		transition_.pause_pending = false;
+		if(const auto err = info.scene_ptr->pause().unwrap(); err) {
+			return error(std::format("failed to pause scene with id: {} name: {}", info.id, info.type_name), *err);
+		}
+	}
+
+	if(const auto err = layout_scene(info).unwrap(); err) {
+		return error(std::format("failed to layout scene with id: {} name: {}", info.id, info.type_name), *err);
+	}
+
+	if(std::exchange(info.show_pending, false) && info.scene_ptr->is_visible()) {
+		if(const auto err = info.scene_ptr->show().unwrap(); err) {
+			return error(std::format("failed to show scene with id: {} name: {}", info.id, info.type_name), *err);
+		}
+	}
+
+	SPDLOG_DEBUG("initialized scene with id: {} name: {}", info.id, info.type_name);
+	return true;
+}
+
+auto app::set_scene_hibernation(const scene_id id, const bool hibernate) -> result<> {
 	std::shared_ptr<scene_info> info;
 	if(const auto err = find_scene_info(id).unwrap(info); err) {
 		return error(std::format("scene with id {} not found", id));
 	}
+	info->hibernates = hibernate;
+	info->hidden_time = 0.0F;
+	return true;
+}
 
-	if(const auto reset_err = info->scene_ptr->reset().unwrap(); reset_err) { // NOLINT(*-ambiguous-smartptr-reset-call)
-		return error(std::format("failed to reset scene with id: {} name: {}", id, info->type_name), *reset_err);
+// at most one scene per frame, ending a scene is not free either
+auto app::update_scene_hibernation(const float delta) -> result<> {
+	for(const auto &info: scenes_) {
+		if(!info->hibernates || !info->initialized || info->scene_ptr->is_visible() || is_in_transition(info->id)) {
+			info->hidden_time = 0.0F;
+			continue;
+		}
+		info->hidden_time += delta;
+		if(info->hidden_time >= hibernation_delay_) {
+			return hibernate_scene(*info);
+		}
 	}
-	SPDLOG_DEBUG("reset scene with id: {} name: {}", id, info->type_name);
+	return true;
+}
 
-	if(const auto layout_err = info->scene_ptr->layout(drawing_resolution_).unwrap(); layout_err) {
-		return error(std::format("failed to layout scene with id: {} name: {}", id, info->type_name), *layout_err);
+auto app::hibernate_scene(scene_info &info) -> result<> {
+	if(const auto err = info.scene_ptr->end().unwrap(); err) {
+		return error(std::format("error ending scene with id: {} name: {}", info.id, info.type_name), *err);
+	}
+	if(const auto err = release_scene_assets(info).unwrap(); err) {
+		return error(std::format("failed to release assets of scene with id: {} name: {}", info.id, info.type_name),
+					 *err);
 	}
 
+	info.scene_ptr.reset(); // NOLINT(*-ambiguous-smartptr-reset-call)
+	info.initialized = false;
+	info.assets_requested = false;
+	info.assets = asset_list{};
+	info.layout_pending = false;
+	info.hidden_time = 0.0F;
+
+	SPDLOG_DEBUG("hibernated scene with id: {} name: {}", info.id, info.type_name);
 	return true;
 }
 
-// =============================================================================
-// Scene Management - Lifecycle
-// =============================================================================
+// creates the scene, hidden, and starts loading its assets right away, update_scene_loading
+// initializes it once they are loaded
+auto app::wake_scene(scene_info &info) -> void {
+	if(info.scene_ptr) {
+		return;
+	}
+	info.scene_ptr = info.factory();
+	info.scene_ptr->set_visible(false);
+	info.scene_ptr->set_job_system(jobs_);
+	info.scene_ptr->set_tick_scheduler(tick_scheduler_);
+	request_scene_assets(info);
+	SPDLOG_DEBUG("created scene with id: {} name: {}", info.id, info.type_name);
+}
 
-auto app::init_scenes() -> result<> {
-	SPDLOG_INFO("init scenes");
-	for(auto &info: scenes_) {
-		if(const auto err = info->scene_ptr->init(*this).unwrap(); err) {
-			return error(std::format("failed to initialize scene with id: {} name: {}", info->id, info->type_name),
-						 *err);
+auto app::release_scene_assets(const scene_info &info) -> result<> {
+	for(const auto &sheet: info.assets.get_sprite_sheets()) {
+		const auto it = sprite_sheet_users_.find(sheet.name);
+		if(it == sprite_sheet_users_.end() || --it->second != 0) {
+			continue;
+		}
+		sprite_sheet_users_.erase(it);
+		// a sheet still loading stays loaded, it is reused if the scene wakes up
+		if(!sprite_sheets_.contains(sheet.name)) {
+			continue;
+		}
+		if(const auto err = unload_sprite_sheet(sheet.name).unwrap(); err) {
+			return error(std::format("failed to unload sprite sheet: {}", sheet.name), *err);
 		}
-		SPDLOG_DEBUG("initialized scene with id: {} name: {}", info->id, info->type_name);
 	}
 	return true;
 }
@@ -390,7 +657,7 @@ auto app::init_scenes() -> result<> {
 auto app::end_all_scenes() -> result<> {
 	SPDLOG_INFO("ending scenes");
 	for(auto &info: scenes_) {
-		if(info->scene_ptr) {
+		if(info->initialized) {
 			if(const auto err = info->scene_ptr->end().unwrap(); err) {
 				return error(std::format("error ending scene with id: {} name: {}", info->id, info->type_name), *err);
 			}
@@ -402,21 +669,146 @@ auto app::end_all_scenes() -> result<> {
 	return true;
 }
 
-auto app::update_all_scenes(const float delta) const -> result<> {
-	for(const auto &info: scenes_) {
-		if(!info->scene_ptr->is_visible()) {
+auto app::update_all_scenes(const float delta) -> result<> {
+	scene_deltas_.assign(scenes_.size(), -1.0F);
+	due_scenes_.clear();
+	for(std::size_t index = 0; index < scenes_.size(); ++index) {
+		auto &info = *scenes_[index];
+		if(!info.is_active() || !info.tick.advance(delta)) {
+			continue;
+		}
+		if(info.tick.is_low_priority()) {
+			due_scenes_.push_back(
+				tick_scheduler::due_update{.index = static_cast<std::uint32_t>(index), .lateness = info.tick.get_lateness()});
 			continue;
 		}
-		if(const auto err = info->scene_ptr->update(delta).unwrap(); err) {
+		scene_deltas_[index] = info.tick.consume();
+	}
+
+	if(parallel_scene_update_ && jobs_.get_worker_count() != 0) {
+		if(const auto err = update_scenes_in_parallel().unwrap(); err) {
+			return error("failed to update scenes in parallel", *err);
+		}
+	} else {
+		for(std::size_t index = 0; index < scenes_.size(); ++index) {
+			if(scene_deltas_[index] < 0.0F) {
+				continue;
+			}
+			const auto &info = *scenes_[index];
+			if(const auto err = info.scene_ptr->update(scene_deltas_[index]).unwrap(); err) {
+				return error(std::format("failed to update scene with id: {} name: {}", info.id, info.type_name), *err);
+			}
+		}
+	}
+
+	// low priority scenes update on the main thread within the frame budget
+	return tick_scheduler_.run(due_scenes_, [this](const std::uint32_t index) -> result<> {
+		auto &info = *scenes_[index];
+		if(const auto err = info.scene_ptr->update(info.tick.consume()).unwrap(); err) {
+			return error(std::format("failed to update scene with id: {} name: {}", info.id, info.type_name), *err);
+		}
+		return true;
+	});
+}
+
+auto app::set_scene_tick_rate(const scene_id id, const tick_rate rate) -> result<> {
+	std::shared_ptr<scene_info> info;
+	if(const auto err = find_scene_info(id).unwrap(info); err) {
+		return error(std::format("scene with id {} not found", id));
+	}
+	info->tick.set_rate(rate);
+	return true;
+}
+
+auto app::enable_fixed_timestep(const float tick_rate, const int max_steps) -> void {
+	fixed_timestep_ = true;
+	fixed_step_ = 1.0F / std::max(tick_rate, 1.0F);
+	max_fixed_steps_ = std::max(max_steps, 1);
+	accumulator_ = 0.0F;
+}
+
+auto app::run_fixed_steps(const float delta) -> result<> {
+	accumulator_ += delta;
+	for(auto step = 0; accumulator_ >= fixed_step_; ++step) {
+		if(step == max_fixed_steps_) {
+			// too far behind, keep the fraction of a step so the interpolation stays continuous
+			accumulator_ = std::fmod(accumulator_, fixed_step_);
+			break;
+		}
+		for(const auto &info: scenes_) {
+			if(!info->is_active()) {
+				continue;
+			}
+			if(const auto err = info->scene_ptr->fixed_update(fixed_step_).unwrap(); err) {
+				return error(
+					std::format("failed on fixed update of scene with id: {} name: {}", info->id, info->type_name), *err);
+			}
+		}
+		accumulator_ -= fixed_step_;
+	}
+	return true;
+}
+
+auto app::update_scenes_in_parallel() -> result<> {
+	scene_commands_.resize(scenes_.size());
+	scene_errors_.resize(scenes_.size());
+
+	const auto update_scene = [this](const std::size_t index) -> void {
+		const command_buffer::scope deferring{scene_commands_[index]};
+		scene_errors_[index] = scenes_[index]->scene_ptr->update(scene_deltas_[index]).unwrap();
+	};
+	const auto updates = [this](const std::size_t index) -> bool {
+		return scene_deltas_[index] >= 0.0F;
+	};
+	const auto runs_in_parallel = [this, &updates](const std::size_t index) -> bool {
+		return updates(index) && scenes_[index]->scene_ptr->is_thread_safe();
+	};
+
+	jobs_.parallel_for(scenes_.size(), 1, [&](const std::size_t begin, const std::size_t end) -> void {
+		for(auto index = begin; index < end; ++index) {
+			if(runs_in_parallel(index)) {
+				update_scene(index);
+			}
+		}
+	});
+	for(std::size_t index = 0; index < scenes_.size(); ++index) {
+		if(updates(index) && !runs_in_parallel(index)) {
+			update_scene(index);
+		}
+	}
+
+	for(auto &commands: scene_commands_) {
+		commands.flush();
+	}
+	for(std::size_t index = 0; index < scenes_.size(); ++index) {
+		if(auto err = std::move(scene_errors_[index]); err) {
+			const auto &info = scenes_[index];
 			return error(std::format("failed to update scene with id: {} name: {}", info->id, info->type_name), *err);
 		}
 	}
 	return true;
 }
 
+auto app::run_frame_tasks() -> result<> {
+	frame_tasks_.clear();
+	for(const auto &info: scenes_) {
+		if(!info->is_active()) {
+			continue;
+		}
+		if(const auto err = info->scene_ptr->schedule(frame_tasks_).unwrap(); err) {
+			return error(std::format("failed to schedule tasks of scene with id: {} name: {}", info->id, info->type_name),
+						 *err);
+		}
+	}
+	if(frame_tasks_.size() != 0) {
+		frame_tasks_.run(jobs_);
+	}
+	return true;
+}
+
 auto app::draw_all_scenes() const -> result<> {
 	for(const auto &info: scenes_) {
-		if(!info->scene_ptr->is_visible()) {
+		if(!info->is_active()) {
 			continue;
 		}
 		if(const auto err = info->scene_ptr->draw().unwrap(); err) {
@@ -426,9 +818,18 @@ auto app::draw_all_scenes() const -> result<> {
 	return true;
 }
 
+// hidden scenes are laid out when they are shown, a resize costs only the scenes on screen
 auto app::layout_all_scenes() const -> result<> {
 	for(const auto &scene_info: scenes_) {
-		if(const auto err = scene_info->scene_ptr->layout(drawing_resolution_).unwrap(); err) {
+		// the others get their layout when they are initialized
+		if(!scene_info->initialized) {
+			continue;
+		}
+		if(!scene_info->scene_ptr->is_visible()) {
+			scene_info->layout_pending = true;
+			continue;
+		}
+		if(const auto err = layout_scene(*scene_info).unwrap(); err) {
 			return error(
 				std::format("failed to layout scene with id: {} name: {}", scene_info->id, scene_info->type_name),
 				*err);
@@ -437,6 +838,12 @@ auto app::layout_all_scenes() const -> result<> {
 	return true;
 }
 
+auto app::layout_scene(scene_info &info) const -> result<> {
+	info.layout_pending = false;
+	info.scene_ptr->set_viewport_size(drawing_resolution_);
+	return info.scene_ptr->layout(drawing_resolution_);
+}
+
 // =============================================================================
 // Scene Management - Built-in
 // =============================================================================
@@ -448,29 +855,39 @@ auto app::register_builtin_scenes() -> void {
 	banner_scene_ = register_scene<banner>();
 	game_overlay_scene_ = register_scene<game_overlay>(999, false);
 	options_scene_ = register_scene<options>(1000, false);
+
+	// shown once, or seldom, options stays resident so escape opens it without a wait
+	for(const auto id: {license_scene_, about_scene_, banner_scene_}) {
+		if(const auto err = set_scene_hibernation(id).unwrap(); err) {
+			SPDLOG_ERROR("failed to enable hibernation of scene {}: {}", id, err->get_message());
+		}
+	}
+	// created hidden up front instead of on first show, so it is initialized by the time it is opened
+	std::shared_ptr<scene_info> options_info;
+	if(const auto err = find_scene_info(options_scene_).unwrap(options_info); err) {
+		SPDLOG_ERROR("failed to find the options scene {}: {}", options_scene_, err->get_message());
+	} else {
+		wake_scene(*options_info);
+	}
+	// the banner loads the sheet of the menu, that is only created after it and never hibernates
+	pin_sprite_sheet(menu::sprite_sheet_name);
 }
 
 auto app::subscribe_to_builtin_events() -> void {
-	version_click_ = on_event<game_overlay::version_click>(this, &app::on_version_click);
-	options_click_ = on_event<game_overlay::options_click>(this, &app::on_options_click);
-	options_closed_ = on_event<options::options_closed>(this, &app::on_options_closed);
-	license_accepted_ = on_event<license::accepted>(this, &app::on_license_accepted);
-	go_to_game_ = on_event<menu::go_to_game>(this, &app::on_go_to_game);
-	back_to_menu_ = bind_event<back_to_menu_from>(this, &app::on_back_to_menu_from);
-	show_about_ = on_event<menu::show_about>(this, &app::on_show_about);
-	about_back_clicked_ = on_event<about::back_clicked>(this, &app::on_about_back_clicked);
-	banner_finished_ = on_event<banner::finished>(this, &app::on_banner_finished);
+	builtin_subscriptions_ = create_subscription_group();
+	builtin_subscriptions_.add(on_event<game_overlay::version_click>(this, &app::on_version_click));
+	builtin_subscriptions_.add(on_event<game_overlay::options_click>(this, &app::on_options_click));
+	builtin_subscriptions_.add(on_event<options::options_closed>(this, &app::on_options_closed));
+	builtin_subscriptions_.add(on_event<license::accepted>(this, &app::on_license_accepted));
+	builtin_subscriptions_.add(on_event<menu::go_to_game>(this, &app::on_go_to_game));
+	builtin_subscriptions_.add(bind_event<back_to_menu_from>(this, &app::on_back_to_menu_from));
+	builtin_subscriptions_.add(on_event<menu::show_about>(this, &app::on_show_about));
+	builtin_subscriptions_.add(on_event<about::back_clicked>(this, &app::on_about_back_clicked));
+	builtin_subscriptions_.add(on_event<banner::finished>(this, &app::on_banner_finished));
 }
 
 auto app::unsubscribe_from_builtin_events() -> void {
-	unsubscribe(version_click_);
-	unsubscribe(options_click_);
-	unsubscribe(options_closed_);
-	unsubscribe(license_accepted_);
-	unsubscribe(go_to_game_);
-	unsubscribe(back_to_menu_);
-	unsubscribe(show_about_);
-	unsubscribe(about_back_clicked_);
+	builtin_subscriptions_.clear();
 }
 
 // =============================================================================
@@ -488,7 +905,7 @@ auto app::on_options_click() -> result<> {
 
 	for(const auto &info: scenes_) {
 		if(info->id != options_scene_) {
-			if(const auto err = info->scene_ptr->pause().unwrap(); err) {
+			if(const auto err = pause_scene(info->id).unwrap(); err) {
 				return error(std::format("failed to pause scene with id: {} ", info->id), *err);
 			}
 		}
@@ -508,7 +925,7 @@ auto app::on_options_closed() -> result<> {
 
 	for(const auto &info: scenes_) {
 		if(info->id != options_scene_) {
-			if(const auto err = info->scene_ptr->resume().unwrap(); err) {
+			if(const auto err = resume_scene(info->id).unwrap(); err) {
 				return error(std::format("failed to resume scene with id: {}", info->id), *err);
 			}
 		}
@@ -742,6 +1159,9 @@ auto app::load_sprite_sheet(const std::string &name, const std::string &path) ->
 	if(sprite_sheets_.contains(name)) {
 		return error(std::format("sprite sheet with name {} is already loaded", name));
 	}
+	if(asset_loader_.is_pending(name)) {
+		return error(std::format("sprite sheet with name {} is already loading in the background", name));
+	}
 
 	sprite_sheet sheet;
 	if(const auto err = sheet.init(path).unwrap(); err) {
@@ -753,6 +1173,27 @@ auto app::load_sprite_sheet(const std::string &name, const std::string &path) ->
 	return true;
 }
 
+auto app::request_sprite_sheet(const std::string &name, const std::string &path) -> void {
+	if(sprite_sheets_.contains(name) || asset_loader_.is_pending(name)) {
+		return;
+	}
+	asset_loader_.request(name, path, jobs_);
+}
+
+auto app::get_loading_progress() const -> loading_progress {
+	auto progress = asset_loader_.get_progress();
+	for(const auto &info: scenes_) {
+		if(!info->scene_ptr) {
+			continue;
+		}
+		++progress.total;
+		if(info->initialized) {
+			++progress.done;
+		}
+	}
+	return progress;
+}
+
 auto app::unload_sprite_sheet(const std::string &name) -> result<> {
 	const auto it = sprite_sheets_.find(name);
 	if(it == sprite_sheets_.end()) {
@@ -1036,6 +1477,9 @@ auto app::init_window() const -> result<> {
 #ifdef PLATFORM_DESKTOP
 	SetConfigFlags(FLAG_WINDOW_RESIZABLE);
 #endif
+	if(headless_) {
+		SetConfigFlags(FLAG_WINDOW_HIDDEN);
+	}
 
 	InitWindow(1920, 1080, title_.c_str());
 	SetExitKey(KEY_NULL);
@@ -1094,7 +1538,7 @@ auto app::toggle_fullscreen() -> bool {
 }
 
 auto app::handle_escape_key() -> result<> {
-	if(!IsKeyReleased(KEY_ESCAPE)) {
+	if(!IsKeyReleased(KEY_ESCAPE) || is_loading()) {
 		return true;
 	}
 
@@ -1103,7 +1547,7 @@ auto app::handle_escape_key() -> result<> {
 		return error("can not find options scene", *err);
 	}
 
-	if(info->scene_ptr->is_visible()) {
+	if(info->scene_ptr && info->scene_ptr->is_visible()) {
 		if(const auto hide_err = on_options_closed().unwrap(); hide_err) {
 			return error("failed to hide options scene", *hide_err);
 		}
@@ -1527,23 +1971,41 @@ auto app::open_url(const std::string &url) -> result<> {
 // =============================================================================
 
 auto app::start_scene_transition(const scene_id from_scene, const scene_id to_scene) -> void {
+	const auto frame_start = transition_clock::now();
+	const auto is_reset = from_scene == to_scene;
+
 	transition_.active = true;
 	transition_.stage = transition_stage::fade_out;
 	transition_.timer = 0.0F;
 	transition_.from_scene = from_scene;
 	transition_.to_scene = to_scene;
+	transition_.next_step = is_reset ? transition_step::reset : transition_step::layout;
+	transition_.stage_start = frame_start;
+	transition_.pause_pending = false;
+	transition_timing_ = transition_timing{};
+
+	// a destination not created yet, or hibernated, loads while the screen fades out, the wait stage
+	// waits for it
+	std::shared_ptr<scene_info> to_info;
+	if(const auto err = find_scene_info(to_scene).unwrap(to_info); !err) {
+		wake_scene(*to_info);
+	}
 
 	// Pause scenes to prevent input during transition
 	// For reset transitions (from == to), only pause once
 	if(const auto err = pause_scene(from_scene).unwrap(); err) {
 		SPDLOG_ERROR("failed to pause from_scene {} during transition start", from_scene);
 	}
-	if(from_scene != to_scene) {
-		if(const auto err = pause_scene(to_scene).unwrap(); err) {
+	if(!is_reset) {
+		// pausing a destination that has not run init would miss the components init creates
+		if(to_info && !to_info->initialized) {
+			transition_.pause_pending = true;
+		} else if(const auto err = pause_scene(to_scene).unwrap(); err) {
 			SPDLOG_ERROR("failed to pause to_scene {} during transition start", to_scene);
 		}
 	}
 
+	transition_timing_.longest_frame = transition_clock::now() - frame_start;
 	SPDLOG_DEBUG("starting scene transition from {} to {}", from_scene, to_scene);
 }
 
@@ -1552,6 +2014,7 @@ auto app::update_scene_transition(const float delta) -> void {
 		return;
 	}
 
+	const auto frame_start = transition_clock::now();
 	transition_.timer += delta;
 
 	const auto is_reset = transition_.from_scene == transition_.to_scene;
@@ -1573,9 +2036,99 @@ auto app::update_scene_transition(const float delta) -> void {
 	default:
 		break;
 	}
+
+	transition_timing_.longest_frame = std::max(transition_timing_.longest_frame, transition_clock::now() - frame_start);
+}
+
+auto app::enter_transition_stage(const transition_stage stage) -> void {
+	const auto now = transition_clock::now();
+	const auto elapsed = now - transition_.stage_start;
+	switch(transition_.stage) {
+	case transition_stage::fade_out:
+		transition_timing_.fade_out = elapsed;
+		break;
+	case transition_stage::wait:
+		transition_timing_.wait = elapsed;
+		break;
+	case transition_stage::fade_in:
+		transition_timing_.fade_in = elapsed;
+		break;
+	case transition_stage::none:
+	default:
+		break;
+	}
+	transition_.stage = stage;
+	transition_.timer = 0.0F;
+	transition_.stage_start = now;
+}
+
+// one step per frame, so getting the destination ready never lands in a single frame. the destination
+// has to be initialized first, one just created may still be loading
+auto app::run_transition_step() -> void {
+	if(transition_.next_step == transition_step::done) {
+		return;
+	}
+
+	std::shared_ptr<scene_info> info;
+	if(const auto err = find_scene_info(transition_.to_scene).unwrap(info); err) {
+		SPDLOG_ERROR("can not find scene {} to get it ready for the transition", transition_.to_scene);
+		transition_.next_step = transition_step::done;
+		return;
+	}
+	if(!info->initialized) {
+		return;
+	}
+
+	auto &scene_ptr = info->scene_ptr;
+	const auto step_start = transition_clock::now();
+	switch(transition_.next_step) {
+	case transition_step::reset:
+		// resumed around the reset so the components it creates are the ones resumed at the end
+		if(const auto err = scene_ptr->resume().unwrap(); err) {
+			SPDLOG_ERROR("failed to resume scene {} before reset", info->id);
+		}
+		if(const auto err = scene_ptr->reset().unwrap(); err) { // NOLINT(*-ambiguous-smartptr-reset-call)
+			SPDLOG_ERROR("failed to reset scene {} during transition: {}", info->id, err->get_message());
+		}
+		if(const auto err = scene_ptr->pause().unwrap(); err) {
+			SPDLOG_ERROR("failed to pause scene {} after reset", info->id);
+		}
+		info->layout_pending = true;
+		transition_timing_.reset = transition_clock::now() - step_start;
+		transition_.next_step = transition_step::layout;
+		break;
+
+	case transition_step::layout:
+		if(!info->layout_pending) {
+			// laid out already, nothing to do in this frame
+		} else if(const auto err = layout_scene(*info).unwrap(); err) {
+			SPDLOG_ERROR("failed to layout scene {} during transition: {}", info->id, err->get_message());
+		}
+		transition_timing_.layout = transition_clock::now() - step_start;
+		transition_.next_step = transition_step::prepare_draw;
+		break;
+
+	case transition_step::prepare_draw:
+		if(const auto err = scene_ptr->prepare_draw().unwrap(); err) {
+			SPDLOG_ERROR("failed to prepare drawing scene {} during transition: {}", info->id, err->get_message());
+		}
+		transition_timing_.prepare_draw = transition_clock::now() - step_start;
+		transition_.next_step = transition_step::done;
+		break;
+
+	case transition_step::done:
+	default:
+		break;
+	}
 }
 
 auto app::handle_fade_out_stage(const bool is_reset) -> void {
+	// a new destination is hidden while the screen fades out, a scene being reset is still on screen
+	// so its steps wait for the black screen
+	if(!is_reset) {
+		run_transition_step();
+	}
+
 	if(transition_.timer < fade_out_duration) {
 		return;
 	}
@@ -1588,8 +2141,7 @@ auto app::handle_fade_out_stage(const bool is_reset) -> void {
 		}
 	}
 
-	transition_.stage = transition_stage::wait;
-	transition_.timer = 0.0F;
+	enter_transition_stage(transition_stage::wait);
 
 	if(is_reset) {
 		SPDLOG_DEBUG("transition: fade out complete, entering wait stage (scene reset)");
@@ -1599,21 +2151,20 @@ auto app::handle_fade_out_stage(const bool is_reset) -> void {
 }
 
 auto app::handle_wait_stage(const bool is_reset) -> void {
-	if(transition_.timer < wait_duration) {
+	run_transition_step();
+
+	// the screen stays black while anything is loading, so the scene shown next has what it needs
+	if(transition_.timer < wait_duration || is_loading() || transition_.next_step != transition_step::done) {
 		return;
 	}
 
-	// Wait complete, resume scene(s) then either reset or show
-	// Always resume from_scene
+	// Destination ready, only resume and flip visibility
+	const auto swap_start = transition_clock::now();
 	if(const auto err = resume_scene(transition_.from_scene).unwrap(); err) {
 		SPDLOG_ERROR("failed to resume from_scene {} before transition action", transition_.from_scene);
 	}
 
 	if(is_reset) {
-		// Scene reset: reset the same scene
-		if(const auto err = reload_scene(transition_.from_scene).unwrap(); err) {
-			SPDLOG_ERROR("failed to reset scene {} during transition", transition_.from_scene);
-		}
 		SPDLOG_DEBUG("transition: wait complete, scene reset, entering fade in stage");
 	} else {
 		// Scene change: resume to_scene then show it
@@ -1630,9 +2181,9 @@ auto app::handle_wait_stage(const bool is_reset) -> void {
 			}
 		}
 	}
+	transition_timing_.swap = transition_clock::now() - swap_start;
 
-	transition_.stage = transition_stage::fade_in;
-	transition_.timer = 0.0F;
+	enter_transition_stage(transition_stage::fade_in);
 }
 
 auto app::handle_fade_in_stage() -> void {
@@ -1641,9 +2192,24 @@ auto app::handle_fade_in_stage() -> void {
 	}
 
 	// Fade in complete, transition finished
+	enter_transition_stage(transition_stage::none);
 	transition_.active = false;
-	transition_.stage = transition_stage::none;
-	SPDLOG_DEBUG("transition: fade in complete, transition finished");
+
+	using milliseconds = std::chrono::duration<float, std::milli>;
+	[[maybe_unused]] const auto to_ms = [](const transition_clock::duration elapsed) -> float {
+		return std::chrono::duration_cast<milliseconds>(elapsed).count();
+	};
+	SPDLOG_DEBUG("transition: fade in complete, transition finished, stages fade out {:.1f} ms wait {:.1f} ms fade in "
+				 "{:.1f} ms, steps reset {:.2f} ms layout {:.2f} ms prepare draw {:.2f} ms swap {:.2f} ms, longest "
+				 "frame {:.2f} ms",
+				 to_ms(transition_timing_.fade_out),
+				 to_ms(transition_timing_.wait),
+				 to_ms(transition_timing_.fade_in),
+				 to_ms(transition_timing_.reset),
+				 to_ms(transition_timing_.layout),
+				 to_ms(transition_timing_.prepare_draw),
+				 to_ms(transition_timing_.swap),
+				 to_ms(transition_timing_.longest_frame));
 }
 
 auto app::draw_transition_overlay() const -> result<> {
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/command_buffer.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace pxe {
+
+namespace {
+
+thread_local command_buffer *current_buffer = nullptr;
+
+} // namespace
+
+auto command_buffer::flush() -> void {
+	auto commands = std::move(commands_);
+	commands_.clear();
+	if(auto *outer = current(); outer != nullptr && outer != this) {
+		for(auto &command: commands) {
+			outer->record(std::move(command));
+		}
+		return;
+	}
+	for(auto &command: commands) {
+		command();
+	}
+}
+
+auto command_buffer::current() -> command_buffer * {
+	return current_buffer;
+}
+
+command_buffer::scope::scope(command_buffer &buffer): previous_{current_buffer} {
+	current_buffer = &buffer;
+}
+
+command_buffer::scope::~scope() {
+	current_buffer = previous_;
+}
+
+} // namespace pxe
@@ -42,6 +42,9 @@ auto button::update(const float delta) -> result<> {
 				return do_click();
 			}
 		}
+		if(!get_app().is_in_controller_mode() && is_picked() && IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) {
+			return do_click();
+		}
 	}
 
 	return true;
@@ -68,18 +71,23 @@ auto button::draw() -> result<> {
 	GuiSetFont(get_font());
 	GuiSetStyle(DEFAULT, TEXT_SIZE, static_cast<int>(get_font_size()));
 
-	if(is_focussed()) {
+	// the scene picks the button under the mouse, raygui only draws it
+	const auto locked = GuiIsLocked();
+	GuiLock();
+	const auto hovered = !locked && is_enabled() && is_picked();
+	if(hovered) {
+		GuiSetState(IsMouseButtonDown(MOUSE_BUTTON_LEFT) ? STATE_PRESSED : STATE_FOCUSED);
+	} else if(is_focussed()) {
 		GuiSetState(STATE_FOCUSED);
 	}
 
-	const auto clicked = GuiButton({.x = x, .y = y, .width = width, .height = height}, text_.c_str());
+	GuiButton({.x = x, .y = y, .width = width, .height = height}, text_.c_str());
 
-	if(is_focussed()) {
+	if(hovered || is_focussed()) {
 		GuiSetState(STATE_NORMAL);
 	}
-
-	if(clicked != 0) {
-		return do_click();
+	if(!locked) {
+		GuiUnlock();
 	}
 
 	if(get_app().is_in_controller_mode() && is_enabled()) {
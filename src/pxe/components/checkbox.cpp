@@ -38,22 +38,29 @@ auto checkbox::draw() -> result<> {
 		GuiEnable();
 	}
 
-	const auto current_value = checked_;
-
 	GuiSetFont(get_font());
 	GuiSetStyle(DEFAULT, TEXT_SIZE, static_cast<int>(get_font_size()));
 
 	const auto [x, y] = get_position();
 
-	if(is_focussed()) {
+	// the scene picks the checkbox under the mouse, raygui only draws it
+	const auto locked = GuiIsLocked();
+	GuiLock();
+	const auto highlighted = is_focussed() || (!locked && is_enabled() && is_picked());
+	if(highlighted) {
 		GuiSetState(STATE_FOCUSED);
 	}
 
 	GuiCheckBox({.x = x, .y = y, .width = check_box_size_, .height = check_box_size_}, title_.c_str(), &checked_);
 
-	if(is_focussed()) {
+	if(highlighted) {
 		GuiSetState(STATE_NORMAL);
+	}
+	if(!locked) {
+		GuiUnlock();
+	}
 
+	if(is_focussed()) {
 		const auto [cw, ch] = get_size();
 		if(const auto err =
 			   get_app().draw_sprite(button_sheet, button_frame_, {.x = x - 10, .y = y + (ch / 2)}).unwrap();
@@ -62,12 +69,6 @@ auto checkbox::draw() -> result<> {
 		}
 	}
 
-	if(current_value != checked_) {
-		if(const auto err = send_event().unwrap(); err) {
-			return error("failed to send checkbox changed event", *err);
-		}
-	}
-
 	return true;
 }
 
@@ -95,6 +96,13 @@ auto checkbox::update(const float delta) -> result<> {
 		}
 	}
 
+	if(!get_app().is_in_controller_mode() && is_picked() && IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) {
+		checked_ = !checked_;
+		if(const auto err = send_event().unwrap(); err) {
+			return error("failed to send checkbox changed event", *err);
+		}
+	}
+
 	return true;
 }
 
@@ -3,6 +3,9 @@
 
 #include <pxe/components/component.hpp>
 #include <pxe/result.hpp>
+#include <pxe/scenes/scene.hpp>
+
+#include <raylib.h>
 
 #include <cstddef>
 
@@ -19,4 +22,26 @@ auto component::end() -> result<> {
 	return true;
 }
 
+auto component::notify_owner() -> void {
+	owner_.owner->child_bounds_changed(owner_.slot);
+}
+
+auto component::wake() -> void {
+	sleep_request_.reset();
+	if(owner_.owner != nullptr) {
+		owner_.owner->child_woken(owner_.slot);
+	}
+}
+
+auto component::is_picked() const -> bool {
+	if(owner_.owner == nullptr) {
+		return enabled_ && visible_ && point_inside(GetMousePosition());
+	}
+	return owner_.owner->is_child_picked(owner_.slot);
+}
+
+auto component::is_sleeping() const -> bool {
+	return owner_.owner != nullptr && !owner_.owner->is_child_awake(owner_.slot);
+}
+
 } // namespace pxe
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/components/component_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+namespace pxe::detail {
+
+block_pool::block_pool(const std::size_t block_size, const std::size_t block_align)
+	: block_size_{block_size}, block_align_{block_align} {}
+
+auto block_pool::allocate() -> void * {
+	if(free_ == nullptr) {
+		grow();
+	}
+	auto *block = free_;
+	free_ = block->next;
+	++in_use_;
+	return block;
+}
+
+auto block_pool::deallocate(void *block) noexcept -> void {
+	auto *freed = ::new(block) free_block{.next = free_};
+	free_ = freed;
+	--in_use_;
+}
+
+auto block_pool::grow() -> void {
+	const auto blocks = next_chunk_blocks_;
+	next_chunk_blocks_ = std::min(next_chunk_blocks_ * 2, max_chunk_blocks);
+
+	auto *chunk = static_cast<std::byte *>(::operator new(blocks * block_size_, std::align_val_t{block_align_}));
+	chunks_.push_back(chunk);
+	capacity_ += blocks;
+
+	// thread the new blocks in address order, so consecutive allocations are contiguous
+	for(std::size_t i = blocks; i > 0; --i) {
+		free_ = ::new(chunk + ((i - 1) * block_size_)) free_block{.next = free_};
+	}
+}
+
+} // namespace pxe::detail
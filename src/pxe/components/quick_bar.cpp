@@ -71,6 +71,25 @@ auto quick_bar::set_position(const Vector2 &pos) -> void {
 	recalculate();
 }
 
+auto quick_bar::get_bounds() const -> Rectangle {
+	if(sprites_.empty()) {
+		const auto [x, y] = get_position();
+		return {.x = x, .y = y, .width = 0.0F, .height = 0.0F};
+	}
+
+	auto [left, top, width, height] = sprites_.front()->get_bounds();
+	auto right = left + width;
+	auto bottom = top + height;
+	for(const auto &sprite_ptr: sprites_) {
+		const auto bounds = sprite_ptr->get_bounds();
+		left = std::min(left, bounds.x);
+		top = std::min(top, bounds.y);
+		right = std::max(right, bounds.x + bounds.width);
+		bottom = std::max(bottom, bounds.y + bounds.height);
+	}
+	return {.x = left, .y = top, .width = right - left, .height = bottom - top};
+}
+
 auto quick_bar::end() -> result<> {
 	for(auto &sprite_ptr: sprites_) {
 		if(const auto err = sprite_ptr->end().unwrap(); err) {
@@ -78,6 +97,7 @@ auto quick_bar::end() -> result<> {
 		}
 	}
 	sprites_.clear();
+	hovered_.reset();
 
 	return ui_component::end();
 }
@@ -93,20 +113,23 @@ auto quick_bar::update(float delta) -> result<> {
 		}
 	}
 
-	const auto mouse = GetMousePosition();
-	for(const auto &sprite_ptr: sprites_) {
-		if(sprite_ptr->point_inside(mouse)) {
-			sprite_ptr->set_tint(hover_color_);
-			if(IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-				if(const auto err = play_click_sfx().unwrap(); err) {
-					return error("failed to play click sfx", *err);
-				}
-				get_app().post_event(button::click{.id = sprite_ptr->get_id()});
-			}
-
-		} else {
-			sprite_ptr->set_tint(normal_color_);
+	// the buttons are only looked for when the scene picked the bar under the mouse
+	const auto hovered = is_picked() ? button_at(GetMousePosition()) : std::nullopt;
+	if(hovered != hovered_) {
+		if(hovered_) {
+			sprites_[*hovered_]->set_tint(normal_color_);
+		}
+		if(hovered) {
+			sprites_[*hovered]->set_tint(hover_color_);
 		}
+		hovered_ = hovered;
+	}
+
+	if(hovered_ && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+		if(const auto err = play_click_sfx().unwrap(); err) {
+			return error("failed to play click sfx", *err);
+		}
+		get_app().post_event(button::click{.id = sprites_[*hovered_]->get_id()});
 	}
 
 	return ui_component::update(delta);
@@ -122,6 +145,18 @@ auto quick_bar::draw() -> result<> {
 	return ui_component::draw();
 }
 
+auto quick_bar::button_at(const Vector2 point) const -> std::optional<std::size_t> {
+	// the buttons are laid out left to right, the first one ending after the point is the only candidate
+	const auto it = std::ranges::lower_bound(sprites_, point.x, {}, [](const auto &sprite_ptr) -> float {
+		const auto bounds = sprite_ptr->get_bounds();
+		return bounds.x + bounds.width;
+	});
+	if(it == sprites_.end() || !(*it)->point_inside(point)) {
+		return std::nullopt;
+	}
+	return static_cast<std::size_t>(it - sprites_.begin());
+}
+
 auto quick_bar::recalculate() -> void {
 	recalculate_size();
 	const auto [width, height] = get_size();
@@ -138,6 +173,9 @@ auto quick_bar::recalculate() -> void {
 		pos_x += sprite_width / 2;
 		pos_x += gap_;
 	}
+
+	// the bounds follow the sprites, that have just moved
+	bounds_changed();
 }
 
 auto quick_bar::recalculate_size() -> void {
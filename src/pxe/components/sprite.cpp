@@ -63,13 +63,12 @@ auto sprite::set_scale(const float scale) -> void {
 	scale_ = scale;
 	set_size({.width = original_size_.width * scale_, .height = original_size_.height * scale_});
 }
-auto sprite::point_inside(const Vector2 point) const -> bool {
+auto sprite::get_bounds() const -> Rectangle {
 	const auto [pos_x, pos_y] = get_position();
-	const auto size = get_size();
+	const auto [width, height] = get_size();
 	const auto [pivot_x, pivot_y] = pivot_;
 
-	return component::point_inside(
-		{.x = pos_x - (pivot_x * size.width), .y = pos_y - (pivot_y * size.height)}, size, point);
+	return {.x = pos_x - (pivot_x * width), .y = pos_y - (pivot_y * height), .width = width, .height = height};
 }
 
 } // namespace pxe
\ No newline at end of file
@@ -79,6 +79,7 @@ auto sprite_anim::reset() -> result<> {
 
 auto sprite_anim::play() -> void {
 	running_ = true;
+	wake();
 	reset();
 }
 
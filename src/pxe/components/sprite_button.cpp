@@ -97,7 +97,7 @@ auto sprite_button::update(const float delta) -> result<> {
 					return error("failed to handle controller click", *err);
 				}
 			}
-		} else if(const auto mouse_pos = GetMousePosition(); sprite_.point_inside(mouse_pos)) {
+		} else if(is_picked()) {
 			hover_ = true;
 			if(IsMouseButtonReleased(MOUSE_BUTTON_LEFT)) {
 				if(const auto err = handle_click().unwrap(); err) {
@@ -64,7 +64,7 @@ auto version_display::update(const float delta) -> result<> {
 		return true;
 	}
 
-	const auto inside = point_inside(GetMousePosition());
+	const auto inside = is_picked();
 
 	if(hover_ && !inside) {
 		SetMouseCursor(MOUSE_CURSOR_DEFAULT);
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/ecs/sprites.hpp>
+#include <pxe/ecs/world.hpp>
+#include <pxe/render/sprite_batch.hpp>
+#include <pxe/render/sprite_sheet.hpp>
+#include <pxe/result.hpp>
+
+#include <format>
+#include <memory>
+#include <utility>
+
+namespace pxe::ecs {
+
+auto move_system(world &entities, const float delta) -> void {
+	entities.each<position, velocity>([delta](position &pos, const velocity &vel) -> void {
+		pos.value.x += vel.value.x * delta;
+		pos.value.y += vel.value.y * delta;
+	});
+}
+
+auto draw_sprites(world &entities, const sprite_sheet &sheet) -> result<> {
+	std::unique_ptr<error> failed;
+	entities.each<position, sprite>([&sheet, &failed](const entity owner, const position &pos, const sprite &spr) -> void {
+		if(failed) {
+			return;
+		}
+		if(auto err = sheet.draw(spr.frame, pos.value, spr.scale, spr.tint).unwrap(); err) {
+			failed = std::make_unique<error>(std::format("failed to draw sprite of entity: {}", owner.index), *err);
+		}
+	});
+	if(failed) {
+		return std::move(*failed);
+	}
+	return true;
+}
+
+auto draw_sprites(world &entities, const sprite_sheet &sheet, sprite_batch &batch, const int layer) -> result<> {
+	std::unique_ptr<error> failed;
+	entities.each<position, sprite>(
+		[&sheet, &batch, layer, &failed](const entity owner, const position &pos, const sprite &spr) -> void {
+			if(failed) {
+				return;
+			}
+			if(auto err = sheet.draw(batch, spr.frame, pos.value, spr.scale, spr.tint, layer).unwrap(); err) {
+				failed = std::make_unique<error>(std::format("failed to batch sprite of entity: {}", owner.index), *err);
+			}
+		});
+	if(failed) {
+		return std::move(*failed);
+	}
+	return true;
+}
+
+} // namespace pxe::ecs
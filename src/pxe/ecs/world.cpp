@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/ecs/world.hpp>
+#include <pxe/result.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <vector>
+
+namespace pxe::ecs {
+
+archetype::archetype(const component_mask &mask, const std::array<std::size_t, max_component_types> &sizes)
+	: mask_{mask} {
+	column_index_.fill(-1);
+	for(std::size_t type = 0; type < max_component_types; ++type) {
+		if(mask.test(type)) {
+			column_index_[type] = static_cast<std::int8_t>(columns_.size());
+			columns_.push_back(column{.type = type, .element_size = sizes[type], .data = {}});
+		}
+	}
+}
+
+auto archetype::get(const std::size_t type, const std::uint32_t row) -> std::byte * {
+	auto *found = find_column(type);
+	return found == nullptr ? nullptr : found->data.data() + (row * found->element_size);
+}
+
+auto archetype::push(const entity owner) -> std::uint32_t {
+	const auto row = static_cast<std::uint32_t>(entities_.size());
+	entities_.push_back(owner);
+	for(auto &col: columns_) {
+		col.data.resize(col.data.size() + col.element_size);
+	}
+	return row;
+}
+
+auto archetype::swap_remove(const std::uint32_t row) -> entity {
+	const auto last = static_cast<std::uint32_t>(entities_.size() - 1);
+	entity moved{};
+	if(row != last) {
+		moved = entities_[last];
+		entities_[row] = moved;
+		for(auto &col: columns_) {
+			std::memcpy(col.data.data() + (row * col.element_size),
+						col.data.data() + (last * col.element_size),
+						col.element_size);
+		}
+	}
+	entities_.pop_back();
+	for(auto &col: columns_) {
+		col.data.resize(col.data.size() - col.element_size);
+	}
+	return moved;
+}
+
+auto world::destroy(const entity target) -> result<> {
+	assert(iterating_ == 0 && "entities can not be destroyed while iterating");
+	auto *found = find_record(target);
+	if(found == nullptr) {
+		return error(std::format("stale entity: {}", target.index));
+	}
+	remove_row(*found->arch, found->row);
+	found->arch = nullptr;
+	++found->generation;
+	free_records_.push_back(target.index);
+	--alive_;
+	return true;
+}
+
+auto world::is_alive(const entity target) const -> bool {
+	return find_record(target) != nullptr;
+}
+
+auto world::clear() -> void {
+	assert(iterating_ == 0 && "world can not be cleared while iterating");
+	for(std::uint32_t index = 0; index < records_.size(); ++index) {
+		if(auto &found = records_[index]; found.arch != nullptr) {
+			found.arch = nullptr;
+			++found.generation;
+			free_records_.push_back(index);
+		}
+	}
+	archetype_by_mask_.clear();
+	archetypes_.clear();
+	alive_ = 0;
+}
+
+auto world::get_archetype(const component_mask &mask) -> archetype & {
+	if(const auto it = archetype_by_mask_.find(mask); it != archetype_by_mask_.end()) {
+		return *it->second;
+	}
+	auto &created = archetypes_.emplace_back(std::make_unique<archetype>(mask, type_sizes_));
+	archetype_by_mask_.emplace(mask, created.get());
+	return *created;
+}
+
+auto world::allocate_entity() -> entity {
+	++alive_;
+	if(free_records_.empty()) {
+		records_.emplace_back();
+		return entity{.index = static_cast<std::uint32_t>(records_.size() - 1), .generation = 1};
+	}
+	const auto index = free_records_.back();
+	free_records_.pop_back();
+	return entity{.index = index, .generation = records_[index].generation};
+}
+
+auto world::remove_row(archetype &arch, const std::uint32_t row) -> void {
+	if(const auto moved = arch.swap_remove(row); moved.is_set()) {
+		records_[moved.index].row = row;
+	}
+}
+
+auto world::move_entity(const entity target, record &from, archetype &to) -> void {
+	auto &source = *from.arch;
+	const auto row = to.push(target);
+	const auto shared = source.get_mask() & to.get_mask();
+	for(std::size_t type = 0; type < max_component_types; ++type) {
+		if(shared.test(type)) {
+			std::memcpy(to.get(type, row), source.get(type, from.row), type_sizes_[type]);
+		}
+	}
+	remove_row(source, from.row);
+	from.arch = &to;
+	from.row = row;
+}
+
+} // namespace pxe::ecs
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/event_recording.hpp>
+#include <pxe/result.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pxe {
+
+namespace {
+
+template<typename T>
+auto write_value(std::ofstream &file, const T &value) -> void {
+	file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+// sequential reader over the loaded file, every read checks the remaining size
+class byte_reader {
+public:
+	explicit byte_reader(const std::span<const std::byte> data): data_{data} {}
+
+	[[nodiscard]] auto at_end() const -> bool {
+		return offset_ >= data_.size();
+	}
+
+	template<typename T>
+	[[nodiscard]] auto read(T &value) -> bool {
+		if(data_.size() - offset_ < sizeof(T)) {
+			return false;
+		}
+		std::memcpy(&value, data_.data() + offset_, sizeof(T));
+		offset_ += sizeof(T);
+		return true;
+	}
+
+	[[nodiscard]] auto read_bytes(const std::size_t count, std::span<const std::byte> &bytes) -> bool {
+		if(data_.size() - offset_ < count) {
+			return false;
+		}
+		bytes = data_.subspan(offset_, count);
+		offset_ += count;
+		return true;
+	}
+
+private:
+	std::span<const std::byte> data_;
+	std::size_t offset_{0};
+};
+
+} // namespace
+
+// =============================================================================
+// Recorder
+// =============================================================================
+
+auto event_recorder::open(const std::filesystem::path &path) -> result<> {
+	if(is_open()) {
+		return error("event recorder is already open");
+	}
+
+	file_.open(path, std::ios::binary | std::ios::trunc);
+	if(!file_.is_open()) {
+		return error(std::format("failed to open event recording file: {}", path.string()));
+	}
+
+	local_types_.clear();
+	next_local_type_ = 0;
+	write_value(file_, magic);
+	write_value(file_, version);
+	return true;
+}
+
+auto event_recorder::close() -> result<> {
+	if(!is_open()) {
+		return true;
+	}
+
+	file_.flush();
+	const auto good = file_.good();
+	file_.close();
+	if(!good) {
+		return error("failed to write event recording file");
+	}
+	return true;
+}
+
+auto event_recorder::get_local_type(const std::size_t type, const std::string_view name) -> std::uint32_t {
+	if(type >= local_types_.size()) {
+		local_types_.resize(type + 1, 0);
+	}
+	if(local_types_[type] != 0) {
+		return local_types_[type] - 1;
+	}
+
+	const auto local = next_local_type_++;
+	local_types_[type] = local + 1;
+	write_value(file_, type_record);
+	write_value(file_, local);
+	write_value(file_, static_cast<std::uint32_t>(name.size()));
+	file_.write(name.data(), static_cast<std::streamsize>(name.size()));
+	return local;
+}
+
+auto event_recorder::write_event(const std::uint64_t frame, const std::uint32_t local) -> void {
+	write_value(file_, event_record);
+	write_value(file_, frame);
+	write_value(file_, local);
+	write_value(file_, static_cast<std::uint32_t>(payload_.size()));
+	file_.write(reinterpret_cast<const char *>(payload_.data()), static_cast<std::streamsize>(payload_.size()));
+}
+
+// =============================================================================
+// Player
+// =============================================================================
+
+auto event_player::open(const std::filesystem::path &path) -> result<> {
+	close();
+
+	std::ifstream file(path, std::ios::binary);
+	if(!file.is_open()) {
+		return error(std::format("failed to open event recording file: {}", path.string()));
+	}
+	const std::vector<char> content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	data_.resize(content.size());
+	std::memcpy(data_.data(), content.data(), content.size());
+
+	byte_reader reader{data_};
+	std::uint32_t file_magic = 0;
+	std::uint32_t file_version = 0;
+	if(!reader.read(file_magic) || !reader.read(file_version) || file_magic != event_recorder::magic) {
+		close();
+		return error(std::format("not an event recording file: {}", path.string()));
+	}
+	if(file_version != event_recorder::version) {
+		close();
+		return error(std::format("unsupported event recording version: {}", file_version));
+	}
+
+	while(!reader.at_end()) {
+		std::uint8_t tag = 0;
+		std::uint32_t type = 0;
+		std::uint32_t size = 0;
+		std::span<const std::byte> bytes;
+		if(!reader.read(tag)) {
+			break;
+		}
+		if(tag == event_recorder::type_record) {
+			if(!reader.read(type) || !reader.read(size) || !reader.read_bytes(size, bytes)
+			   || type != type_names_.size()) {
+				close();
+				return error("corrupted type declaration in event recording");
+			}
+			type_names_.emplace_back(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+		} else if(tag == event_recorder::event_record) {
+			std::uint64_t frame = 0;
+			if(!reader.read(frame) || !reader.read(type) || !reader.read(size) || !reader.read_bytes(size, bytes)
+			   || type >= type_names_.size()) {
+				close();
+				return error("corrupted event in event recording");
+			}
+			events_.push_back({.frame = frame, .type = type, .payload = bytes});
+		} else {
+			close();
+			return error(std::format("unknown record in event recording: {}", tag));
+		}
+	}
+
+	open_ = true;
+	return true;
+}
+
+auto event_player::close() -> void {
+	open_ = false;
+	events_.clear();
+	type_names_.clear();
+	data_.clear();
+	next_ = 0;
+}
+
+} // namespace pxe
@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/job_system.hpp>
+#include <pxe/result.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <spdlog/spdlog.h>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace pxe {
+
+namespace {
+
+// queue of the job system the current thread works for, threads that are not workers have none
+thread_local const job_system *current_system = nullptr;
+thread_local std::size_t current_queue = 0;
+
+} // namespace
+
+auto task_group::run(std::function<void()> job) -> void {
+	{
+		const std::scoped_lock lock{mutex_};
+		pending_.fetch_add(1, std::memory_order_relaxed);
+	}
+	jobs_->push(std::move(job), this);
+}
+
+auto task_group::then(std::function<void()> continuation) -> void {
+	{
+		const std::scoped_lock lock{mutex_};
+		if(pending_.load(std::memory_order_relaxed) != 0) {
+			continuations_.push_back(std::move(continuation));
+			return;
+		}
+		pending_.fetch_add(1, std::memory_order_relaxed);
+	}
+	jobs_->push(std::move(continuation), this);
+}
+
+auto task_group::wait() -> void {
+	while(!is_done()) {
+		if(!jobs_->run_one()) {
+			std::this_thread::yield();
+		}
+	}
+	// the job finishing the group may still hold the lock, the group must outlive it
+	const std::scoped_lock lock{mutex_};
+}
+
+auto task_group::finish() -> void {
+	std::vector<std::function<void()>> ready;
+	{
+		const std::scoped_lock lock{mutex_};
+		if(pending_.load(std::memory_order_relaxed) == 1 && !continuations_.empty()) {
+			ready.swap(continuations_);
+			pending_.fetch_add(ready.size(), std::memory_order_relaxed);
+		}
+		pending_.fetch_sub(1, std::memory_order_release);
+	}
+	for(auto &continuation: ready) {
+		jobs_->push(std::move(continuation), this);
+	}
+}
+
+job_system::~job_system() {
+	end();
+}
+
+auto job_system::init(std::size_t workers) -> result<> {
+#ifdef __EMSCRIPTEN__
+	workers = 0;
+#else
+	if(workers == 0) {
+		workers = std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1;
+	}
+#endif
+
+	stopping_ = false;
+	queues_.clear();
+	for(std::size_t i = 0; i <= workers; ++i) {
+		queues_.push_back(std::make_unique<job_queue>());
+	}
+
+	threads_.reserve(workers);
+	for(std::size_t i = 1; i <= workers; ++i) {
+		try {
+			threads_.emplace_back([this, i]() -> void { run_worker(i); });
+		} catch(const std::system_error &e) {
+			end();
+			return error(std::format("failed to start worker thread: {}", e.what()));
+		}
+	}
+
+	SPDLOG_DEBUG("job system started with {} workers", threads_.size());
+	return true;
+}
+
+auto job_system::end() -> void {
+	{
+		const std::scoped_lock lock{sleep_mutex_};
+		stopping_ = true;
+	}
+	wake_.notify_all();
+	for(auto &thread: threads_) {
+		thread.join();
+	}
+	threads_.clear();
+}
+
+auto job_system::run_one() -> bool {
+	if(auto next = pop_or_steal(get_own_queue()); next) {
+		execute(*next);
+		return true;
+	}
+	return false;
+}
+
+auto job_system::push(std::function<void()> work, task_group *group) -> void {
+	if(threads_.empty()) {
+		auto inline_job = job{.work = std::move(work), .group = group};
+		execute(inline_job);
+		return;
+	}
+	{
+		auto &queue = *queues_[get_own_queue()];
+		const std::scoped_lock lock{queue.mutex};
+		queue.jobs.push_back(job{.work = std::move(work), .group = group});
+	}
+	queued_.fetch_add(1, std::memory_order_release);
+	{
+		// a worker checking for jobs before going to sleep either sees this one or gets the wake up
+		const std::scoped_lock lock{sleep_mutex_};
+	}
+	wake_.notify_one();
+}
+
+auto job_system::pop_or_steal(const std::size_t own) -> std::optional<job> {
+	if(queued_.load(std::memory_order_acquire) == 0) {
+		return std::nullopt;
+	}
+	{
+		auto &queue = *queues_[own];
+		const std::scoped_lock lock{queue.mutex};
+		if(!queue.jobs.empty()) {
+			auto next = std::move(queue.jobs.back());
+			queue.jobs.pop_back();
+			queued_.fetch_sub(1, std::memory_order_relaxed);
+			return next;
+		}
+	}
+	for(std::size_t offset = 1; offset < queues_.size(); ++offset) {
+		auto &queue = *queues_[(own + offset) % queues_.size()];
+		const std::scoped_lock lock{queue.mutex};
+		if(!queue.jobs.empty()) {
+			auto next = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+			queued_.fetch_sub(1, std::memory_order_relaxed);
+			return next;
+		}
+	}
+	return std::nullopt;
+}
+
+auto job_system::get_own_queue() const -> std::size_t {
+	return current_system == this ? current_queue : shared_queue;
+}
+
+auto job_system::execute(job &next) -> void {
+	next.work();
+	if(next.group != nullptr) {
+		next.group->finish();
+	}
+}
+
+auto job_system::run_worker(const std::size_t index) -> void {
+	current_system = this;
+	current_queue = index;
+	while(true) {
+		for(auto attempt = 0; attempt < steal_attempts; ++attempt) {
+			if(!run_one()) {
+				std::this_thread::yield();
+			}
+		}
+		std::unique_lock lock{sleep_mutex_};
+		wake_.wait(lock, [this]() -> bool {
+			return stopping_ || queued_.load(std::memory_order_acquire) != 0;
+		});
+		if(stopping_ && queued_.load(std::memory_order_acquire) == 0) {
+			return;
+		}
+	}
+}
+
+auto task_graph::add(std::function<void()> job, const std::initializer_list<task_id> after) -> task_id {
+	const auto id = nodes_.size();
+	auto &added = nodes_.emplace_back();
+	added.job = std::move(job);
+	added.dependencies = after.size();
+	for(const auto dependency: after) {
+		assert(dependency < id && "a task can only depend on tasks added before it");
+		nodes_[dependency].successors.push_back(id);
+	}
+	return id;
+}
+
+auto task_graph::run(job_system &jobs) -> void {
+	for(auto &pending: nodes_) {
+		pending.remaining.store(pending.dependencies, std::memory_order_relaxed);
+	}
+	task_group group{jobs};
+	for(task_id id = 0; id < nodes_.size(); ++id) {
+		if(nodes_[id].dependencies == 0) {
+			launch(group, id);
+		}
+	}
+	group.wait();
+}
+
+auto task_graph::launch(task_group &group, const task_id id) -> void {
+	group.run([this, &group, id]() -> void {
+		auto &current = nodes_[id];
+		current.job();
+		for(const auto successor: current.successors) {
+			if(nodes_[successor].remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				launch(group, successor);
+			}
+		}
+	});
+}
+
+} // namespace pxe
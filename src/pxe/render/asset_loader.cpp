@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/job_system.hpp>
+#include <pxe/render/asset_loader.hpp>
+#include <pxe/render/sprite_sheet.hpp>
+#include <pxe/result.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace pxe {
+
+auto asset_loader::request(const std::string &name, const std::string &path, job_system &jobs) -> void {
+	if(is_pending(name)) {
+		return;
+	}
+	if(pending_.empty()) {
+		requested_ = 0;
+		uploaded_ = 0;
+	}
+	++requested_;
+
+	auto load = std::make_shared<pending_load>(name, path);
+	pending_.push_back(load);
+	SPDLOG_DEBUG("requested sprite sheet {} from {}", name, path);
+
+	jobs.submit([load = std::move(load)]() -> void {
+		load->failure = load->sheet.load(load->path).unwrap();
+		load->decoded.store(true, std::memory_order_release);
+	});
+}
+
+auto asset_loader::is_pending(const std::string &name) const -> bool {
+	return std::ranges::any_of(pending_, [&name](const auto &load) -> bool { return load->name == name; });
+}
+
+auto asset_loader::upload(std::unordered_map<std::string, sprite_sheet> &sheets, const std::size_t max_uploads)
+	-> result<> {
+	std::size_t uploads = 0;
+	for(auto it = pending_.begin(); it != pending_.end() && uploads < max_uploads;) {
+		auto &load = **it;
+		if(!load.decoded.load(std::memory_order_acquire)) {
+			++it;
+			continue;
+		}
+		// loaded some other way while it was decoding, the sheet there is kept and the image dropped
+		if(sheets.contains(load.name)) {
+			SPDLOG_DEBUG("sprite sheet {} was already loaded, dropping the decoded one", load.name);
+			it = pending_.erase(it);
+			++uploaded_;
+			continue;
+		}
+		if(!load.failure) {
+			load.failure = load.sheet.upload().unwrap();
+		}
+		if(load.failure) {
+			auto failure = std::move(load.failure);
+			const auto message = std::format("failed to load sprite sheet {} from path: {}", load.name, load.path);
+			pending_.erase(it);
+			return error(message, *failure);
+		}
+		sheets.emplace(load.name, std::move(load.sheet));
+		SPDLOG_DEBUG("loaded sprite sheet {} from {}", load.name, load.path);
+		it = pending_.erase(it);
+		++uploaded_;
+		++uploads;
+	}
+	return true;
+}
+
+} // namespace pxe
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/render/camera.hpp>
+
+#include <raylib.h>
+
+#include <cmath>
+
+namespace pxe {
+
+auto camera::set_zoom(const float zoom) -> void {
+	if(zoom > 0.0F) {
+		zoom_ = zoom;
+	}
+}
+
+auto camera::get_view() const -> Rectangle {
+	const auto [x, y] = get_snapped_target();
+	const auto width = viewport_.width / zoom_;
+	const auto height = viewport_.height / zoom_;
+	return {.x = x - (width / 2), .y = y - (height / 2), .width = width, .height = height};
+}
+
+auto camera::to_camera_2d() const -> Camera2D {
+	return Camera2D{
+		.offset = {.x = viewport_.width / 2, .y = viewport_.height / 2},
+		.target = get_snapped_target(),
+		.rotation = 0.0F,
+		.zoom = zoom_,
+	};
+}
+
+auto camera::screen_to_world(const Vector2 point) const -> Vector2 {
+	const auto [x, y] = get_snapped_target();
+	return {.x = ((point.x - (viewport_.width / 2)) / zoom_) + x, .y = ((point.y - (viewport_.height / 2)) / zoom_) + y};
+}
+
+auto camera::world_to_screen(const Vector2 point) const -> Vector2 {
+	const auto [x, y] = get_snapped_target();
+	return {.x = ((point.x - x) * zoom_) + (viewport_.width / 2), .y = ((point.y - y) * zoom_) + (viewport_.height / 2)};
+}
+
+auto camera::get_snapped_target() const -> Vector2 {
+	if(!pixel_snap_) {
+		return target_;
+	}
+	return {.x = std::round(target_.x * zoom_) / zoom_, .y = std::round(target_.y * zoom_) / zoom_};
+}
+
+} // namespace pxe
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/render/render_queue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace pxe {
+
+auto render_queue::make_key(const int layer, const float depth) -> std::uint64_t {
+	const auto layer_bits = static_cast<std::uint32_t>(layer) ^ 0x80000000U;
+	auto depth_bits = std::bit_cast<std::uint32_t>(depth);
+	// negative floats have their order reversed, flip all their bits, positive ones only the sign
+	depth_bits = (depth_bits & 0x80000000U) != 0 ? ~depth_bits : depth_bits | 0x80000000U;
+	return (static_cast<std::uint64_t>(layer_bits) << 32U) | depth_bits;
+}
+
+auto render_queue::sort() -> void {
+	static constexpr std::size_t radix_bits = 8;
+	static constexpr std::size_t buckets = 1U << radix_bits;
+	static constexpr std::size_t passes = 64 / radix_bits;
+	// below this the histogram setup costs more than a comparison sort
+	static constexpr std::size_t radix_threshold = 256;
+
+	const auto count = entries_.size();
+	if(count < radix_threshold) {
+		std::ranges::stable_sort(entries_, {}, &entry::key);
+		return;
+	}
+
+	// histograms for every pass in a single read of the keys
+	std::array<std::array<std::size_t, buckets>, passes> histograms{};
+	for(const auto &item: entries_) {
+		for(std::size_t pass = 0; pass < passes; ++pass) {
+			++histograms[pass][(item.key >> (pass * radix_bits)) & (buckets - 1)];
+		}
+	}
+
+	scratch_.resize(count);
+	for(std::size_t pass = 0; pass < passes; ++pass) {
+		auto &histogram = histograms[pass];
+		const auto shift = pass * radix_bits;
+
+		// every key has the same digit, this pass would not change the order
+		if(histogram[(entries_.front().key >> shift) & (buckets - 1)] == count) {
+			continue;
+		}
+
+		std::size_t offset = 0;
+		for(auto &bucket: histogram) {
+			offset += std::exchange(bucket, offset);
+		}
+		for(const auto &item: entries_) {
+			scratch_[histogram[(item.key >> shift) & (buckets - 1)]++] = item;
+		}
+		entries_.swap(scratch_);
+	}
+}
+
+} // namespace pxe
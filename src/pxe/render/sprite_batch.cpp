@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/render/render_queue.hpp>
+#include <pxe/render/sprite_batch.hpp>
+
+#include <raylib.h>
+#include <rlgl.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace pxe {
+
+auto sprite_batch::begin() -> void {
+	assert(!drawing_ && "sprite batch already begun");
+	drawing_ = true;
+	quads_.clear();
+	order_.clear();
+}
+
+auto sprite_batch::add(
+	const Texture2D &texture, const Rectangle source, const Rectangle dest, const Color tint, const int layer) -> void {
+	assert(drawing_ && "sprite batch not begun");
+	const auto width = static_cast<float>(texture.width);
+	const auto height = static_cast<float>(texture.height);
+	// the layer of the render queue key with the texture in place of the depth
+	const auto key = (render_queue::make_key(layer) & 0xFFFFFFFF00000000U) | texture.id;
+	order_.push(key, static_cast<std::uint32_t>(quads_.size()));
+	quads_.push_back(quad{
+		.dest = dest,
+		.left = source.x / width,
+		.top = source.y / height,
+		.right = (source.x + source.width) / width,
+		.bottom = (source.y + source.height) / height,
+		.tint = tint,
+		.texture_id = texture.id,
+	});
+}
+
+auto sprite_batch::end() -> void {
+	assert(drawing_ && "sprite batch not begun");
+	drawing_ = false;
+	stats_ = frame_stats{.sprites = quads_.size(), .draw_calls = 0};
+	order_.sort();
+
+	// runs of quads with the same texture, split so every run fits in what is left of the rlgl buffer
+	unsigned int current_texture = 0;
+	auto it = order_.begin();
+	while(it != order_.end()) {
+		const auto texture_id = quads_[it->index].texture_id;
+		std::size_t count = 0;
+		for(auto next = it; next != order_.end() && count < quads_per_check; ++next, ++count) {
+			if(quads_[next->index].texture_id != texture_id) {
+				break;
+			}
+		}
+
+		// a full buffer is drawn first, the run starts a new draw call even with the same texture
+		const auto flushed = rlCheckRenderBatchLimit(static_cast<int>(count * 4));
+		if(flushed || texture_id != current_texture) {
+			++stats_.draw_calls;
+			current_texture = texture_id;
+		}
+
+		rlSetTexture(texture_id);
+		rlBegin(RL_QUADS);
+		rlNormal3f(0.0F, 0.0F, 1.0F);
+		for(const auto last = it + static_cast<std::ptrdiff_t>(count); it != last; ++it) {
+			emit(quads_[it->index]);
+		}
+		rlEnd();
+		rlSetTexture(0);
+	}
+}
+
+// same vertex order as DrawTexturePro, counter clockwise from the top left
+auto sprite_batch::emit(const quad &item) -> void {
+	const auto &[dest, left, top, right, bottom, tint, texture_id] = item;
+	rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+	rlTexCoord2f(left, top);
+	rlVertex2f(dest.x, dest.y);
+	rlTexCoord2f(left, bottom);
+	rlVertex2f(dest.x, dest.y + dest.height);
+	rlTexCoord2f(right, bottom);
+	rlVertex2f(dest.x + dest.width, dest.y + dest.height);
+	rlTexCoord2f(right, top);
+	rlVertex2f(dest.x + dest.width, dest.y);
+}
+
+} // namespace pxe
@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: MIT
 
 #include <pxe/components/component.hpp>
+#include <pxe/render/sprite_batch.hpp>
 #include <pxe/render/sprite_sheet.hpp>
 #include <pxe/render/texture.hpp>
 #include <pxe/result.hpp>
 
 #include <raylib.h>
 
+#include <cstdint>
 #include <format>
 #include <fstream>
 #include <jsoncons/json_decoder.hpp>
@@ -24,6 +26,13 @@
 namespace pxe {
 
 auto sprite_sheet::init(const std::string &path) -> result<> {
+	if(const auto err = load(path).unwrap(); err) {
+		return error("failed to load sprite sheet", *err);
+	}
+	return upload();
+}
+
+auto sprite_sheet::load(const std::string &path) -> result<> {
 	std::ifstream const file(path);
 	if(!file.is_open()) {
 		return error(std::format("sprite sheet file not found: {}", path));
@@ -56,6 +65,13 @@ auto sprite_sheet::init(const std::string &path) -> result<> {
 	return true;
 }
 
+auto sprite_sheet::upload() -> result<> {
+	if(const auto err = texture_.upload().unwrap(); err) {
+		return error("failed to upload sprite sheet texture", *err);
+	}
+	return true;
+}
+
 auto sprite_sheet::end() -> result<> {
 	if(const auto err = texture_.end().unwrap(); err) {
 		return error("failed to end texture", *err);
@@ -64,24 +80,66 @@ auto sprite_sheet::end() -> result<> {
 }
 auto sprite_sheet::draw(const std::string &name, const Vector2 &pos, const float &scale, const Color &tint) const
 	-> result<> {
-	const auto it = frames_.find(name);
-	if(it == frames_.end()) {
+	const auto it = frame_index_.find(name);
+	if(it == frame_index_.end()) {
 		return error(std::format("frame not found in sprite sheet: {}", name));
 	}
+	return draw_frame(frames_[it->second], pos, scale, tint);
+}
+
+auto sprite_sheet::draw(const frame_handle frame, const Vector2 &pos, const float &scale, const Color &tint) const
+	-> result<> {
+	if(frame.index >= frames_.size()) {
+		return error(std::format("invalid frame handle: {}", frame.index));
+	}
+	return draw_frame(frames_[frame.index], pos, scale, tint);
+}
+
+auto sprite_sheet::draw(sprite_batch &batch,
+						const frame_handle frame,
+						const Vector2 &pos,
+						const float &scale,
+						const Color &tint,
+						const int layer) const -> result<> {
+	if(frame.index >= frames_.size()) {
+		return error(std::format("invalid frame handle: {}", frame.index));
+	}
+	const auto &data = frames_[frame.index];
+	if(const auto err = texture_.draw(batch, data.origin, get_destination(data, pos, scale), tint, layer).unwrap();
+	   err) {
+		return error("failed to batch sprite sheet frame", *err);
+	}
+	return true;
+}
+
+auto sprite_sheet::draw_frame(const frame &data, const Vector2 &pos, const float &scale, const Color &tint) const
+	-> result<> {
+	const auto destination = get_destination(data, pos, scale);
+	if(const auto err = texture_.draw(data.origin, destination, tint, 0.0F, Vector2{.x = 0.0F, .y = 0.0F}).unwrap();
+	   err) {
+		return error("failed to draw sprite sheet frame", *err);
+	}
 
-	const auto &[origin, pivot] = it->second;
-	const Rectangle destination = {
+	return true;
+}
+
+// the pivot of the frame lands on the position
+auto sprite_sheet::get_destination(const frame &data, const Vector2 &pos, const float &scale) -> Rectangle {
+	const auto &[origin, pivot] = data;
+	return {
 		.x = pos.x - (pivot.x * origin.width * scale),
 		.y = pos.y - (pivot.y * origin.height * scale),
 		.width = origin.width * scale,
 		.height = origin.height * scale,
 	};
+}
 
-	if(const auto err = texture_.draw(origin, destination, tint, 0.0F, Vector2{.x = 0.0F, .y = 0.0F}).unwrap(); err) {
-		return error("failed to draw sprite sheet frame", *err);
+auto sprite_sheet::get_frame(const std::string &name) const -> result<frame_handle> {
+	const auto it = frame_index_.find(name);
+	if(it == frame_index_.end()) {
+		return error(std::format("frame not found in sprite sheet: {}", name));
 	}
-
-	return true;
+	return frame_handle{.index = it->second};
 }
 
 auto sprite_sheet::frame_size(const std::string &name) const -> result<size> {
@@ -147,11 +205,13 @@ auto sprite_sheet::parse_frames(const jsoncons::json &parser) -> result<> {
 		const auto py = pivot_data.get_value_or<float>("y", 0);
 		const Vector2 pivot{.x = px, .y = py};
 
-		frames_.emplace(name,
-						frame{
-							.origin = origin,
-							.pivot = pivot,
-						});
+		if(const auto [it, inserted] = frame_index_.try_emplace(name, static_cast<std::uint32_t>(frames_.size()));
+		   inserted) {
+			frames_.push_back(frame{
+				.origin = origin,
+				.pivot = pivot,
+			});
+		}
 
 		SPDLOG_DEBUG("adding frame: {}", name);
 	}
@@ -173,19 +233,19 @@ auto sprite_sheet::parse_meta(const jsoncons::json &parser, const std::filesyste
 
 	const auto image_path = base_path / image;
 
-	if(const auto err = texture_.init(image_path.string()).unwrap(); err) {
-		return error("failed to initialize texture for sprite sheet", *err);
+	if(const auto err = texture_.load(image_path.string()).unwrap(); err) {
+		return error("failed to load texture for sprite sheet", *err);
 	}
 
 	return true;
 }
 
 auto sprite_sheet::get_frame_data(const std::string &name) const -> result<frame> {
-	const auto frame_entry = frames_.find(name);
-	if(frame_entry == frames_.end()) {
+	const auto frame_entry = frame_index_.find(name);
+	if(frame_entry == frame_index_.end()) {
 		return error(std::format("frame not found in sprite sheet: {}", name));
 	}
-	return frame_entry->second;
+	return frames_[frame_entry->second];
 }
 
 } // namespace pxe
\ No newline at end of file
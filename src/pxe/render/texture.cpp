@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <pxe/components/component.hpp>
+#include <pxe/render/sprite_batch.hpp>
 #include <pxe/render/texture.hpp>
 #include <pxe/result.hpp>
 
@@ -15,25 +16,57 @@
 namespace pxe {
 
 auto texture::init(const std::string &path) -> result<> {
+	if(const auto err = load(path).unwrap(); err) {
+		return error("failed to load texture", *err);
+	}
+	return upload();
+}
+
+auto texture::load(const std::string &path) -> result<> {
 	if(std::ifstream const font_file(path); !font_file.is_open()) {
 		return error(std::format("can not load texture file: {}", path));
 	}
 
-	const auto loaded_texture = LoadTexture(path.c_str());
+	const auto loaded_image = LoadImage(path.c_str());
+	if(loaded_image.data == nullptr) {
+		return error(std::format("failed to load image from file {}", path));
+	}
+
+	discard();
+	image_ = loaded_image;
+	path_ = path;
+
+	return true;
+}
+
+auto texture::upload() -> result<> {
+	if(image_.data == nullptr) {
+		return error("texture has no image to upload");
+	}
+
+	const auto loaded_texture = LoadTextureFromImage(image_);
+	discard();
 	if(loaded_texture.id == 0) {
-		return error(std::format("failed to load texture from file {}", path));
+		return error(std::format("failed to load texture from file {}", path_));
 	}
 
-	SetTextureFilter(texture_, TEXTURE_FILTER_POINT);
+	SetTextureFilter(loaded_texture, TEXTURE_FILTER_POINT);
 	texture_ = loaded_texture;
 	size_.width = static_cast<float>(loaded_texture.width);
 	size_.height = static_cast<float>(loaded_texture.height);
 
-	SPDLOG_DEBUG("texture: loaded from file: {} ({}x{})", path, size_.width, size_.height);
+	SPDLOG_DEBUG("texture: loaded from file: {} ({}x{})", path_, size_.width, size_.height);
 
 	return true;
 }
 
+auto texture::discard() -> void {
+	if(image_.data != nullptr) {
+		UnloadImage(image_);
+		image_ = Image{};
+	}
+}
+
 auto texture::end() -> result<> {
 	UnloadTexture(texture_);
 	texture_ = Texture2D{};
@@ -62,4 +95,13 @@ auto texture::draw(const Rectangle origin,
 	return true;
 }
 
+auto texture::draw(sprite_batch &batch, const Rectangle origin, const Rectangle dest, const Color tint, const int layer)
+	const -> result<> {
+	if(texture_.id == 0) {
+		return error("texture not initialized");
+	}
+	batch.add(texture_, origin, dest, tint, layer);
+	return true;
+}
+
 } // namespace pxe
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <pxe/app.hpp>
 #include <pxe/components/component.hpp>
 #include <pxe/components/sprite.hpp>
+#include <pxe/render/asset_loader.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/banner.hpp>
 #include <pxe/scenes/scene.hpp>
@@ -14,36 +15,50 @@
 
 namespace pxe {
 
+auto banner::declare_assets(asset_list &assets) const -> void {
+	assets.add_sprite_sheet(sprite_sheet_name, sprite_sheet_path);
+}
+
 auto banner::init(app &app) -> result<> {
 	if(const auto err = scene::init(app).unwrap(); err) {
-		return error("Failed to initialize base scene", err);
+		return error("Failed to initialize base scene", *err);
 	}
 
 	if(const auto err = register_component<sprite>(sprite_sheet_name, logo_frame).unwrap(logo_); err) {
-		return error("Failed to register logo sprite", err);
+		return error("Failed to register logo sprite", *err);
 	}
 
+	std::shared_ptr<sprite> sprite_component;
+	if(const auto err = get_component<sprite>(logo_).unwrap(sprite_component); err) {
+		return error("Failed to get logo sprite component", *err);
+	}
+	sprite_component->set_idle(true);
+
 	return true;
 }
 
 auto banner::layout(const size screen_size) -> result<> {
 	if(const auto err = scene::layout(screen_size).unwrap(); err) {
-		return error("Failed to layout base scene", err);
+		return error("Failed to layout base scene", *err);
 	}
 
 	std::shared_ptr<sprite> sprite_component;
 	if(const auto err = get_component<sprite>(logo_).unwrap(sprite_component); err) {
-		return error("Failed to get logo sprite component", err);
+		return error("Failed to get logo sprite component", *err);
 	}
 
 	sprite_component->set_position({.x = screen_size.width / 2.0F, .y = screen_size.height / 2.0F});
 
+	const auto bounds = sprite_component->get_bounds();
+	progress_position_ = {.x = (screen_size.width - progress_width) / 2.0F,
+						  .y = bounds.y + bounds.height + progress_margin};
+
 	return true;
 }
 
 auto banner::update(const float delta) -> result<> {
 	if(const auto err = scene::update(delta).unwrap(); err) {
-		return error("Failed to update base scene: {}", err);
+		return error("Failed to update base scene: {}", *err);
 	}
 
 	if(!is_enabled() || !is_visible()) {
@@ -69,6 +84,9 @@ auto banner::update(const float delta) -> result<> {
 	}
 
 	total_time_ += delta;
+	if(get_app().is_loading()) {
+		return true;
+	}
 	if(total_time_ >= time_to_show || skip) {
 		get_app().post_event(finished{});
 	}
@@ -76,4 +94,26 @@ auto banner::update(const float delta) -> result<> {
 	return true;
 }
 
+auto banner::draw() -> result<> {
+	if(const auto err = scene::draw().unwrap(); err) {
+		return error("Failed to draw base scene", *err);
+	}
+
+	const auto progress = get_app().get_loading_progress();
+	if(!is_visible() || progress.is_complete()) {
+		return true;
+	}
+
+	const auto x = static_cast<int>(progress_position_.x);
+	const auto y = static_cast<int>(progress_position_.y);
+	DrawRectangleLines(x, y, static_cast<int>(progress_width), static_cast<int>(progress_height), progress_color);
+	DrawRectangle(x,
+				  y,
+				  static_cast<int>(progress_width * progress.get_ratio()),
+				  static_cast<int>(progress_height),
+				  progress_color);
+
+	return true;
+}
+
 } // namespace pxe
\ No newline at end of file
@@ -57,7 +57,7 @@ auto game_overlay::layout(const size screen_size) -> result<> {
 	// Layout version display
 	std::shared_ptr<version_display> version;
 	if(const auto err = get_component<version_display>(version_display_).unwrap(version); err) {
-		return error("failed to get version display component", err);
+		return error("failed to get version display component", *err);
 	}
 
 	const auto [width, height] = version->get_size();
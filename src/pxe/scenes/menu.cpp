@@ -5,12 +5,14 @@
 #include <pxe/components/button.hpp>
 #include <pxe/components/component.hpp>
 #include <pxe/components/sprite.hpp>
+#include <pxe/render/asset_loader.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/menu.hpp>
 #include <pxe/scenes/scene.hpp>
 
 #include <raylib.h>
 
+#include <format>
 #include <memory>
 #include <optional>
 #include <raygui.h>
@@ -18,6 +20,11 @@
 
 namespace pxe {
 
+// the banner shows the logo from this sheet too, it stays loaded until the app ends
+auto menu::declare_assets(asset_list &assets) const -> void {
+	assets.add_sprite_sheet(sprite_sheet_name, sprite_sheet_path);
+}
+
 auto menu::init(app &app) -> result<> {
 	if(const auto err = scene::init(app).unwrap(); err) {
 		return error("failed to initialize base component", *err);
@@ -70,10 +77,6 @@ auto menu::init(app &app) -> result<> {
 
 	button_click_ = app.bind_event<button::click>(this, &menu::on_button_click);
 
-	if(const auto err = app.load_sprite_sheet(sprite_sheet_name, sprite_sheet_path).unwrap(); err) {
-		return error("failed to initialize sprite sheet", *err);
-	}
-
 	const auto logo_sheet = get_app().get_logo_sheet();
 	const auto logo_frame = get_app().get_logo_frame();
 
@@ -89,6 +92,7 @@ auto menu::init(app &app) -> result<> {
 	if(const auto err = get_component<sprite>(title_).unwrap(title); err) {
 		return error("failed to get title sprite component", *err);
 	}
+	title->set_idle(true);
 
 	SPDLOG_INFO("menu scene initialized");
 
@@ -97,9 +101,6 @@ auto menu::init(app &app) -> result<> {
 
 auto menu::end() -> result<> {
 	get_app().unsubscribe(button_click_);
-	if(const auto err = get_app().unload_sprite_sheet(sprite_sheet_name).unwrap(); err) {
-		return error("failed to end sprite sheet", *err);
-	}
 	return scene::end();
 }
 
@@ -170,8 +171,8 @@ auto menu::show() -> result<> {
 		return error("failed to enable base scene", *err);
 	}
 
-	if(const auto err = get_app().play_music("resources/music/menu.ogg").unwrap(); err) {
-		return error(menu_music_path, *err);
+	if(const auto err = get_app().play_music(menu_music_path).unwrap(); err) {
+		return error(std::format("failed to play menu music: {}", menu_music_path), *err);
 	}
 
 	return true;
@@ -25,7 +25,7 @@ auto options::init(app &app) -> result<> {
 		return error("failed to initialize options scene", *err);
 	}
 
-	if(const auto err = register_component<window>().unwrap(window_); err) {
+	if(const auto err = add_component<window>().unwrap(window_); err) {
 		return error("failed to register window component", *err);
 	}
 
@@ -36,13 +36,14 @@ auto options::init(app &app) -> result<> {
 	window_component->set_title("Options");
 	window_component->set_size({.width = window_width, .height = window_height});
 
-	close_window_ = app.on_event<window::close>(this, &options::on_close_window);
+	subscriptions_ = app.create_subscription_group();
+	subscriptions_.add(app.on_event<window::close>(this, &options::on_close_window));
 
-	if(const auto err = register_component<audio_slider>().unwrap(music_slider_); err) {
+	if(const auto err = add_component<audio_slider>().unwrap(music_slider_); err) {
 		return error("failed to register music slider component", *err);
 	}
 
-	if(const auto err = register_component<audio_slider>().unwrap(sfx_slider_); err) {
+	if(const auto err = add_component<audio_slider>().unwrap(sfx_slider_); err) {
 		return error("failed to register sfx slider component", *err);
 	}
 
@@ -64,9 +65,9 @@ auto options::init(app &app) -> result<> {
 	sfx_slider_component->set_label_width(audio_label_width);
 	sfx_slider_component->set_slider_width(audio_slider_width);
 
-	slider_change_ = app.bind_event<audio_slider::audio_slider_changed>(this, &options::on_slider_change);
+	subscriptions_.add(app.bind_event<audio_slider::audio_slider_changed>(this, &options::on_slider_change));
 
-	if(const auto err = register_component<checkbox>().unwrap(crt_cb_); err) {
+	if(const auto err = add_component<checkbox>().unwrap(crt_cb_); err) {
 		return error("failed to register crt checkbox component", *err);
 	}
 	std::shared_ptr<checkbox> checkbox_component;
@@ -75,7 +76,7 @@ auto options::init(app &app) -> result<> {
 	}
 	checkbox_component->set_title("Show CRT");
 
-	if(const auto err = register_component<checkbox>().unwrap(scan_lines_cb_); err) {
+	if(const auto err = add_component<checkbox>().unwrap(scan_lines_cb_); err) {
 		return error("failed to register scan lines checkbox component", *err);
 	}
 	if(const auto err = get_component<checkbox>(scan_lines_cb_).unwrap(checkbox_component); err) {
@@ -83,7 +84,7 @@ auto options::init(app &app) -> result<> {
 	}
 	checkbox_component->set_title("Enable Scan Lines");
 
-	if(const auto err = register_component<checkbox>().unwrap(color_bleed_cb_); err) {
+	if(const auto err = add_component<checkbox>().unwrap(color_bleed_cb_); err) {
 		return error("failed to register color bleed checkbox component", *err);
 	}
 	if(const auto err = get_component<checkbox>(color_bleed_cb_).unwrap(checkbox_component); err) {
@@ -91,7 +92,7 @@ auto options::init(app &app) -> result<> {
 	}
 	checkbox_component->set_title("Enable Color Bleed");
 
-	if(const auto err = register_component<checkbox>().unwrap(fullscreen_cb_); err) {
+	if(const auto err = add_component<checkbox>().unwrap(fullscreen_cb_); err) {
 		return error("failed to register fullscreen checkbox component", *err);
 	}
 	if(const auto err = get_component<checkbox>(fullscreen_cb_).unwrap(checkbox_component); err) {
@@ -99,7 +100,7 @@ auto options::init(app &app) -> result<> {
 	}
 	checkbox_component->set_title("Fullscreen");
 
-	if(const auto err = register_component<button>().unwrap(back_button_); err) {
+	if(const auto err = add_component<button>().unwrap(back_button_); err) {
 		return error("failed to register back button component", *err);
 	}
 
@@ -112,7 +113,7 @@ auto options::init(app &app) -> result<> {
 	back_button_ptr->set_controller_button(GAMEPAD_BUTTON_MIDDLE_RIGHT);
 
 #ifndef __EMSCRIPTEN__
-	if(const auto err = register_component<button>().unwrap(quit_button_); err) {
+	if(const auto err = add_component<button>().unwrap(quit_button_); err) {
 		return error("failed to register quit button component", *err);
 	}
 
@@ -126,8 +127,8 @@ auto options::init(app &app) -> result<> {
 	quit_button_ptr->set_controller_button(GAMEPAD_BUTTON_RIGHT_FACE_UP);
 #endif
 
-	checkbox_changed_ = app.bind_event<checkbox::checkbox_changed>(this, &options::on_checkbox_changed);
-	button_click_ = app.bind_event<button::click>(this, &options::on_button_click);
+	subscriptions_.add(app.bind_event<checkbox::checkbox_changed>(this, &options::on_checkbox_changed));
+	subscriptions_.add(app.bind_event<button::click>(this, &options::on_button_click));
 
 	ui_components_.push_back(music_slider_);
 	ui_components_.push_back(sfx_slider_);
@@ -140,10 +141,7 @@ auto options::init(app &app) -> result<> {
 }
 
 auto options::end() -> result<> {
-	get_app().unsubscribe(close_window_);
-	get_app().unsubscribe(slider_change_);
-	get_app().unsubscribe(checkbox_changed_);
-	get_app().unsubscribe(button_click_);
+	subscriptions_.clear();
 
 	return scene::end();
 }
@@ -268,11 +266,11 @@ auto options::update(const float delta) -> result<> {
 
 	const auto &app = get_app();
 	if(app.is_in_controller_mode()) {
-		size_t focus = 0;
+		component_handle<ui_component> focus;
 		if(const auto err = get_focus().unwrap(focus); err) {
 			return error("failed to get focused component", *err);
 		}
-		if(focus == 0) {
+		if(!focus.is_set()) {
 			if(const auto err = set_focus(music_slider_).unwrap(); err) {
 				return error("failed to set focus", *err);
 			}
@@ -324,11 +322,11 @@ auto options::show() -> result<> {
 	}
 
 	if(get_app().is_in_controller_mode()) {
-		size_t focus = 0;
+		component_handle<ui_component> focus;
 		if(const auto err = get_focus().unwrap(focus); err) {
 			return error("failed to get focused component", *err);
 		}
-		if(focus == 0) {
+		if(!focus.is_set()) {
 			if(const auto err = set_focus(music_slider_).unwrap(); err) {
 				return error("failed to set focus", *err);
 			}
@@ -345,10 +343,10 @@ auto options::on_close_window() -> result<> {
 
 auto options::on_slider_change(const audio_slider::audio_slider_changed &change) -> result<> {
 	const auto value = static_cast<float>(change.value) / 100.0F;
-	if(change.id == music_slider_) {
+	if(change.id == music_slider_.get_id()) {
 		get_app().set_music_volume(value);
 		get_app().set_music_muted(change.muted);
-	} else if(change.id == sfx_slider_) {
+	} else if(change.id == sfx_slider_.get_id()) {
 		get_app().set_sfx_volume(value);
 		get_app().set_sfx_muted(change.muted);
 	}
@@ -356,7 +354,8 @@ auto options::on_slider_change(const audio_slider::audio_slider_changed &change)
 	return true;
 }
 
-auto options::set_slider_values(const size_t slider, const float value, const bool muted) const -> result<> {
+auto options::set_slider_values(const component_handle<audio_slider> slider, const float value, const bool muted) const
+	-> result<> {
 	std::shared_ptr<audio_slider> music_slider_component;
 	if(const auto err = get_component<audio_slider>(slider).unwrap(music_slider_component); err) {
 		return error("failed to get music slider component", *err);
@@ -368,7 +367,7 @@ auto options::set_slider_values(const size_t slider, const float value, const bo
 	return true;
 }
 
-auto options::set_checkbox_value(const size_t cb, const bool value) const -> result<> {
+auto options::set_checkbox_value(const component_handle<checkbox> cb, const bool value) const -> result<> {
 	std::shared_ptr<checkbox> checkbox_component;
 	if(const auto err = get_component<checkbox>(cb).unwrap(checkbox_component); err) {
 		return error("failed to get checkbox component", *err);
@@ -379,13 +378,13 @@ auto options::set_checkbox_value(const size_t cb, const bool value) const -> res
 }
 
 auto options::on_checkbox_changed(const checkbox::checkbox_changed &change) -> result<> {
-	if(change.id == crt_cb_) {
+	if(change.id == crt_cb_.get_id()) {
 		get_app().set_crt_enabled(change.checked);
-	} else if(change.id == scan_lines_cb_) {
+	} else if(change.id == scan_lines_cb_.get_id()) {
 		get_app().set_scan_lines_enabled(change.checked);
-	} else if(change.id == color_bleed_cb_) {
+	} else if(change.id == color_bleed_cb_.get_id()) {
 		get_app().set_color_bleed_enabled(change.checked);
-	} else if(change.id == fullscreen_cb_) {
+	} else if(change.id == fullscreen_cb_.get_id()) {
 		get_app().toggle_fullscreen();
 	}
 
@@ -393,36 +392,36 @@ auto options::on_checkbox_changed(const checkbox::checkbox_changed &change) -> r
 }
 
 auto options::on_button_click(const button::click &click) -> result<> {
-	if(click.id == back_button_) {
+	if(click.id == back_button_.get_id()) {
 		get_app().post_event(options_closed{});
-	} else if(click.id == quit_button_) {
+	} else if(quit_button_.is_set() && click.id == quit_button_.get_id()) {
 		get_app().close();
 	}
 	return true;
 }
 
-auto options::get_focus() const -> result<size_t> {
-	for(const auto &component_id: ui_components_) {
+auto options::get_focus() const -> result<component_handle<ui_component>> {
+	for(const auto &handle: ui_components_) {
 		std::shared_ptr<ui_component> ui_comp;
-		if(const auto err = get_component<ui_component>(component_id).unwrap(ui_comp); err) {
+		if(const auto err = get_component(handle).unwrap(ui_comp); err) {
 			return error("failed to get ui component", *err);
 		}
 
 		if(ui_comp->is_focussed()) {
-			return component_id;
+			return handle;
 		}
 	}
 
-	return 0;
+	return component_handle<ui_component>{};
 }
 
-auto options::set_focus(size_t id) const -> result<> {
-	for(const auto &component_id: ui_components_) {
+auto options::set_focus(const component_handle<ui_component> focus) const -> result<> {
+	for(const auto &handle: ui_components_) {
 		std::shared_ptr<ui_component> ui_comp;
-		if(const auto err = get_component<ui_component>(component_id).unwrap(ui_comp); err) {
+		if(const auto err = get_component(handle).unwrap(ui_comp); err) {
 			return error("failed to get ui component", *err);
 		}
-		if(component_id == id) {
+		if(handle == focus) {
 			ui_comp->set_focussed(true);
 		} else {
 			ui_comp->set_focussed(false);
@@ -432,21 +431,21 @@ auto options::set_focus(size_t id) const -> result<> {
 	return true;
 }
 
-auto options::move_focus(const size_t focus, const direction dir) -> result<> {
+auto options::move_focus(const component_handle<ui_component> focus, const direction dir) -> result<> {
 	std::shared_ptr<ui_component> focused_comp;
-	if(const auto err = get_component<ui_component>(focus).unwrap(focused_comp); err) {
+	if(const auto err = get_component(focus).unwrap(focused_comp); err) {
 		return error("failed to get focused ui component", *err);
 	}
 	const auto [fx, fy] = focused_comp->get_position();
-	size_t best_id = 0;
+	component_handle<ui_component> best;
 	float best_distance = -1.0F;
-	for(const auto &component_id: ui_components_) {
-		if(component_id == focus) {
+	for(const auto &handle: ui_components_) {
+		if(handle == focus) {
 			continue;
 		}
 
 		std::shared_ptr<ui_component> ui_comp;
-		if(const auto err = get_component<ui_component>(component_id).unwrap(ui_comp); err) {
+		if(const auto err = get_component(handle).unwrap(ui_comp); err) {
 			return error("failed to get ui component", *err);
 		}
 		const auto [ux, uy] = ui_comp->get_position();
@@ -462,12 +461,12 @@ auto options::move_focus(const size_t focus, const direction dir) -> result<> {
 		const auto distance = std::abs(vertical_distance);
 		if((best_distance < 0) || (distance < best_distance)) {
 			best_distance = distance;
-			best_id = component_id;
+			best = handle;
 		}
 	}
 
-	if(best_id != 0) {
-		if(const auto err = set_focus(best_id).unwrap(); err) {
+	if(best.is_set()) {
+		if(const auto err = set_focus(best).unwrap(); err) {
 			return error("failed to set focus to new component", *err);
 		}
 		if(const auto err = get_app().play_sfx(click_sound).unwrap(); err) {
@@ -1,43 +1,415 @@
-﻿#include <pxe/components/component.hpp>
+﻿#include <pxe/command_buffer.hpp>
+#include <pxe/components/component.hpp>
+#include <pxe/ecs/world.hpp>
+#include <pxe/render/camera.hpp>
+#include <pxe/render/render_queue.hpp>
 #include <pxe/result.hpp>
 #include <pxe/scenes/scene.hpp>
+#include <pxe/scenes/spatial_hash.hpp>
+
+#include <raylib.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <spdlog/spdlog.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace pxe {
 
+scene::~scene() {
+	for(const auto &entry: children_) {
+		entry.comp->owner_.owner = nullptr;
+	}
+}
+
 auto scene::end() -> result<> {
-	for(auto &[comp, layer, type_name]: children_) {
+	for(auto &[comp, layer, type_name, slot]: children_) {
 		if(const auto err = comp->end().unwrap(); err) {
 			return error(std::format("error ending component with id: {} name: {}", comp->get_id(), type_name), *err);
 		}
 	}
+	if(world_) {
+		world_->clear();
+	}
 	return component::end();
 }
 auto scene::update(const float delta) -> result<> {
-	for(auto &[comp, layer, type_name]: children_) {
-		if(const auto err = comp->update(delta).unwrap(); err) {
-			return error(std::format("error updating component with id: {} name: {}", comp->get_id(), type_name), *err);
+	collect_awake_children(delta);
+	if(parallel_update_ && jobs_ != nullptr && jobs_->get_worker_count() != 0) {
+		if(const auto err = update_children_in_parallel().unwrap(); err) {
+			return error("error updating components in parallel", *err);
+		}
+	} else {
+		for(const auto &[position, child_delta]: updating_) {
+			const auto &[comp, layer, type_name, slot] = children_[position];
+			if(const auto err = comp->update(child_delta).unwrap(); err) {
+				return error(std::format("error updating component with id: {} name: {}", comp->get_id(), type_name),
+							 *err);
+			}
+		}
+	}
+	if(const auto err = update_low_priority_children().unwrap(); err) {
+		return error("error updating low priority components", *err);
+	}
+	sleep_idle_children();
+	if(world_) {
+		for(std::size_t i = 0; i < update_systems_.size(); ++i) {
+			if(const auto err = update_systems_[i](*world_, delta).unwrap(); err) {
+				return error(std::format("error running update system: {}", i), *err);
+			}
 		}
 	}
 	return component::update(delta);
 }
 
+auto scene::fixed_update(const float step) -> result<> {
+	for(auto &[comp, layer, type_name, slot]: children_) {
+		if(const auto err = comp->fixed_update(step).unwrap(); err) {
+			return error(
+				std::format("error on fixed update of component with id: {} name: {}", comp->get_id(), type_name), *err);
+		}
+	}
+	if(world_) {
+		for(std::size_t i = 0; i < fixed_systems_.size(); ++i) {
+			if(const auto err = fixed_systems_[i](*world_, step).unwrap(); err) {
+				return error(std::format("error running fixed system: {}", i), *err);
+			}
+		}
+	}
+	return component::fixed_update(step);
+}
+
 auto scene::draw() -> result<> {
-	std::ranges::sort(children_, [](const child &a, const child &b) -> bool { return a.layer < b.layer; });
-	for(auto &[comp, layer, type_name]: children_) {
+	draw_stats_ = draw_stats{};
+	if(!camera_enabled_) {
+		return draw_content();
+	}
+	BeginMode2D(camera_.to_camera_2d());
+	auto drawn = draw_content();
+	EndMode2D();
+	return drawn;
+}
+
+auto scene::prepare_draw() -> result<> {
+	if(render_order_dirty_) {
+		build_render_queue();
+	}
+	return true;
+}
+
+auto scene::draw_content() -> result<> {
+	if(world_) {
+		for(std::size_t i = 0; i < draw_systems_.size(); ++i) {
+			if(const auto err = draw_systems_[i](*world_).unwrap(); err) {
+				return error(std::format("error running draw system: {}", i), *err);
+			}
+		}
+	}
+	if(render_order_dirty_) {
+		build_render_queue();
+	}
+	const auto view = camera_.get_view();
+	for(const auto &entry: render_queue_) {
+		const auto &[comp, layer, type_name, slot] = children_[entry.index];
+		if(comp->is_visible()) {
+			if(camera_enabled_ && !CheckCollisionRecs(view, comp->get_bounds())) {
+				++draw_stats_.culled;
+				continue;
+			}
+			++draw_stats_.drawn;
+		}
 		if(const auto err = comp->draw().unwrap(); err) {
 			return error(std::format("error drawing component with id: {} name: {}", comp->get_id(), type_name), *err);
 		}
 	}
 	return component::draw();
 }
+
+auto scene::update_low_priority_children() -> result<> {
+	if(due_children_.empty()) {
+		return true;
+	}
+	const auto update_due = [this](const std::uint32_t slot) -> result<> {
+		const auto position = slots_[slot].child;
+		const auto delta = slots_[slot].tick.consume();
+		updating_.push_back(child_update{.position = position, .delta = delta});
+		const auto &[comp, layer, type_name, child_slot] = children_[position];
+		if(const auto err = comp->update(delta).unwrap(); err) {
+			return error(std::format("error updating component with id: {} name: {}", comp->get_id(), type_name),
+						 *err);
+		}
+		return true;
+	};
+	if(tick_scheduler_ == nullptr) {
+		for(const auto &due: due_children_) {
+			if(const auto err = update_due(due.index).unwrap(); err) {
+				return error("error running a low priority update", *err);
+			}
+		}
+		return true;
+	}
+	return tick_scheduler_->run(due_children_, update_due);
+}
+
+auto scene::update_children_in_parallel() -> result<> {
+	const auto count = updating_.size();
+	child_commands_.resize(count);
+	child_errors_.resize(count);
+
+	const auto update_child = [this](const std::size_t index) -> void {
+		const command_buffer::scope deferring{child_commands_[index]};
+		const auto &[position, delta] = updating_[index];
+		child_errors_[index] = children_[position].comp->update(delta).unwrap();
+	};
+
+	jobs_->parallel_for(count, [&](const std::size_t begin, const std::size_t end) -> void {
+		for(auto index = begin; index < end; ++index) {
+			if(children_[updating_[index].position].comp->is_thread_safe()) {
+				update_child(index);
+			}
+		}
+	});
+	for(std::size_t index = 0; index < count; ++index) {
+		if(!children_[updating_[index].position].comp->is_thread_safe()) {
+			update_child(index);
+		}
+	}
+
+	for(std::size_t index = 0; index < count; ++index) {
+		child_commands_[index].flush();
+	}
+	for(std::size_t index = 0; index < count; ++index) {
+		if(auto err = std::move(child_errors_[index]); err) {
+			const auto &[comp, layer, type_name, slot] = children_[updating_[index].position];
+			return error(std::format("error updating component with id: {} name: {}", comp->get_id(), type_name), *err);
+		}
+	}
+	return true;
+}
+
+auto scene::collect_awake_children(const float delta) -> void {
+	update_clock_ += delta;
+	std::erase_if(wake_timers_, [this](const wake_timer &timer) -> bool {
+		if(slots_[timer.slot].generation != timer.generation) {
+			return true;
+		}
+		if(timer.time > update_clock_) {
+			return false;
+		}
+		slots_[timer.slot].awake = true;
+		awake_slots_.push_back(timer.slot);
+		return true;
+	});
+
+	// a component under the mouse may start hovering or get clicked
+	const auto mouse = GetMousePosition();
+	const auto moved = !last_mouse_ || last_mouse_->x != mouse.x || last_mouse_->y != mouse.y;
+	if(moved || IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) {
+		wake_children_at(mouse);
+	}
+	last_mouse_ = mouse;
+	picked_slot_ = pick_slot(mouse);
+
+	// components woken during the updates wait for the next frame
+	updating_.clear();
+	due_children_.clear();
+	for(const auto slot: awake_slots_) {
+		auto &tick = slots_[slot].tick;
+		if(!tick.advance(delta)) {
+			continue;
+		}
+		if(tick.is_low_priority()) {
+			due_children_.push_back(tick_scheduler::due_update{.index = slot, .lateness = tick.get_lateness()});
+			continue;
+		}
+		updating_.push_back(child_update{.position = slots_[slot].child, .delta = tick.consume()});
+	}
+	std::ranges::sort(updating_, {}, &child_update::position);
+}
+
+auto scene::sleep_idle_children() -> void {
+	auto slept = false;
+	for(const auto &update: updating_) {
+		auto &[comp, layer, type_name, slot] = children_[update.position];
+		if(!comp->sleep_request_ && !comp->is_idle()) {
+			continue;
+		}
+		if(const auto seconds = comp->sleep_request_.value_or(std::numeric_limits<float>::infinity());
+		   seconds != std::numeric_limits<float>::infinity()) {
+			wake_timers_.push_back(
+				wake_timer{.slot = slot, .generation = slots_[slot].generation, .time = update_clock_ + seconds});
+		}
+		comp->sleep_request_.reset();
+		slots_[slot].awake = false;
+		slept = true;
+	}
+	if(slept) {
+		std::erase_if(awake_slots_, [this](const std::uint32_t slot) -> bool { return !slots_[slot].awake; });
+	}
+}
+
+auto scene::wake_children_at(const Vector2 screen_point) -> void {
+	const auto point = camera_enabled_ ? camera_.screen_to_world(screen_point) : screen_point;
+	spatial_hash_.for_each_at(point, [&](const std::uint32_t slot) -> void {
+		if(!slots_[slot].awake && CheckCollisionPointRec(point, children_[slots_[slot].child].comp->get_bounds())) {
+			wake_child(slot);
+		}
+	});
+}
+
+auto scene::wake_child(const std::uint32_t slot) -> void {
+	if(slots_[slot].awake) {
+		return;
+	}
+	slots_[slot].awake = true;
+	awake_slots_.push_back(slot);
+	std::erase_if(wake_timers_, [slot](const wake_timer &timer) -> bool { return timer.slot == slot; });
+}
+
+auto scene::get_world() -> ecs::world & {
+	if(!world_) {
+		world_ = std::make_unique<ecs::world>();
+	}
+	return *world_;
+}
+
+auto scene::insert_child(std::shared_ptr<component> comp, const std::string_view type_name) -> std::uint32_t {
+	std::uint32_t index = 0;
+	if(free_slots_.empty()) {
+		index = static_cast<std::uint32_t>(slots_.size());
+		slots_.emplace_back();
+	} else {
+		index = free_slots_.back();
+		free_slots_.pop_back();
+	}
+	slots_[index].child = static_cast<std::uint32_t>(children_.size());
+	// every component gets at least one update before it can sleep
+	slots_[index].awake = true;
+	slots_[index].tick = tick_timer{};
+	awake_slots_.push_back(index);
+	slot_by_id_.insert_or_assign(comp->get_id(), index);
+	comp->owner_.owner = this;
+	comp->owner_.slot = index;
+	spatial_hash_.set(index, comp->get_bounds());
+	children_.emplace_back(child{.comp = std::move(comp), .layer = 0, .type_name = type_name, .slot = index});
+	render_order_dirty_ = true;
+	return index;
+}
+
+auto scene::remove_child(const std::vector<child>::iterator it) -> result<> {
+	const auto id = it->comp->get_id();
+	if(const auto err = it->comp->end().unwrap(); err) {
+		return error(std::format("error ending component with id: {}", id), *err);
+	}
+	[[maybe_unused]] const auto type_name = it->type_name;
+
+	// retire the slot, handles holding the old generation no longer resolve
+	auto &freed = slots_[it->slot];
+	++freed.generation;
+	free_slots_.push_back(it->slot);
+	slot_by_id_.erase(id);
+	spatial_hash_.remove(it->slot);
+	if(picked_slot_ == it->slot) {
+		picked_slot_.reset();
+	}
+	if(freed.awake) {
+		freed.awake = false;
+		std::erase(awake_slots_, it->slot);
+	}
+	it->comp->owner_.owner = nullptr;
+
+	// keep registration order, the children after the removed one move down one position
+	const auto position = static_cast<std::size_t>(it - children_.begin());
+	children_.erase(it);
+	for(auto i = position; i < children_.size(); ++i) {
+		slots_[children_[i].slot].child = static_cast<std::uint32_t>(i);
+	}
+
+	render_order_dirty_ = true;
+	SPDLOG_DEBUG("component with id: {} name: {} removed", id, type_name);
+	return true;
+}
+
+auto scene::build_render_queue() -> void {
+	render_queue_.clear();
+	for(std::size_t i = 0; i < children_.size(); ++i) {
+		const auto &[comp, layer, type_name, slot] = children_[i];
+		const auto depth = y_sort_ ? comp->get_position().y : 0.0F;
+		render_queue_.push(render_queue::make_key(layer, depth), static_cast<std::uint32_t>(i));
+	}
+	render_queue_.sort();
+	render_order_dirty_ = false;
+}
+
+auto scene::child_bounds_changed(const std::uint32_t slot) -> void {
+	if(auto *deferred = command_buffer::current(); deferred != nullptr) {
+		// a slot freed before the buffer runs belongs to another component by then
+		deferred->record([this, slot, generation = slots_[slot].generation]() -> void {
+			if(slots_[slot].generation == generation) {
+				child_bounds_changed(slot);
+			}
+		});
+		return;
+	}
+	wake_child(slot);
+	spatial_hash_.set(slot, children_[slots_[slot].child].comp->get_bounds());
+	if(y_sort_) {
+		render_order_dirty_ = true;
+	}
+}
+
+auto scene::child_woken(const std::uint32_t slot) -> void {
+	if(auto *deferred = command_buffer::current(); deferred != nullptr) {
+		deferred->record([this, slot, generation = slots_[slot].generation]() -> void {
+			if(slots_[slot].generation == generation) {
+				wake_child(slot);
+			}
+		});
+		return;
+	}
+	wake_child(slot);
+}
+
+auto scene::pick(const Vector2 screen_point) const -> component * {
+	const auto slot = pick_slot(screen_point);
+	return slot ? children_[slots_[*slot].child].comp.get() : nullptr;
+}
+
+auto scene::pick_slot(const Vector2 screen_point) const -> std::optional<std::uint32_t> {
+	const auto point = camera_enabled_ ? camera_.screen_to_world(screen_point) : screen_point;
+	std::optional<std::uint32_t> top;
+	std::uint64_t top_key = 0;
+	std::uint32_t top_position = 0;
+	spatial_hash_.for_each_at(point, [&](const std::uint32_t slot) -> void {
+		const auto position = slots_[slot].child;
+		const auto &candidate = children_[position];
+		const auto &comp = *candidate.comp;
+		if(!comp.is_enabled() || !comp.is_visible() || !CheckCollisionPointRec(point, comp.get_bounds())) {
+			return;
+		}
+		// same order as the draw order, a later key or a later registration draws on top
+		const auto key = render_queue::make_key(candidate.layer, y_sort_ ? comp.get_position().y : 0.0F);
+		if(!top || key > top_key || (key == top_key && position > top_position)) {
+			top = slot;
+			top_key = key;
+			top_position = position;
+		}
+	});
+	return top;
+}
+
 auto scene::pause() -> result<> {
 	set_enabled(false);
 	paused_components_.clear();
-	for(auto &[comp, layer, type_name]: children_) {
+	for(auto &[comp, layer, type_name, slot]: children_) {
 		const auto id = comp->get_id();
 		const auto was_enabled = comp->is_enabled();
 		auto pause_result = paused_component{.id = id, .enabled = was_enabled};
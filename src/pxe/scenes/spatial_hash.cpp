@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/scenes/spatial_hash.hpp>
+
+#include <raylib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace pxe {
+
+auto spatial_hash::set(const std::uint32_t item, const Rectangle &bounds) -> void {
+	if(item >= items_.size()) {
+		items_.resize(item + 1);
+	}
+	const auto range = range_of(bounds);
+	auto &current = items_[item];
+	if(current == range) {
+		return;
+	}
+	unlink(item, current);
+	link(item, range);
+	current = range;
+}
+
+auto spatial_hash::remove(const std::uint32_t item) -> void {
+	if(item >= items_.size()) {
+		return;
+	}
+	unlink(item, items_[item]);
+	items_[item] = cell_range{};
+}
+
+auto spatial_hash::clear() -> void {
+	items_.clear();
+	cells_.clear();
+	oversized_.clear();
+}
+
+auto spatial_hash::cell_of(const float coordinate) const -> int {
+	return static_cast<int>(std::floor(coordinate / cell_size_));
+}
+
+auto spatial_hash::range_of(const Rectangle &bounds) const -> cell_range {
+	if(bounds.width <= 0.0F || bounds.height <= 0.0F) {
+		return cell_range{};
+	}
+	return cell_range{
+		.min_x = cell_of(bounds.x),
+		.min_y = cell_of(bounds.y),
+		.max_x = cell_of(bounds.x + bounds.width),
+		.max_y = cell_of(bounds.y + bounds.height),
+	};
+}
+
+auto spatial_hash::link(const std::uint32_t item, const cell_range &range) -> void {
+	if(range.is_empty()) {
+		return;
+	}
+	if(is_oversized(range)) {
+		oversized_.push_back(item);
+		return;
+	}
+	for(auto y = range.min_y; y <= range.max_y; ++y) {
+		for(auto x = range.min_x; x <= range.max_x; ++x) {
+			cells_[key(x, y)].push_back(item);
+		}
+	}
+}
+
+auto spatial_hash::unlink(const std::uint32_t item, const cell_range &range) -> void {
+	if(range.is_empty()) {
+		return;
+	}
+	if(is_oversized(range)) {
+		erase_item(oversized_, item);
+		return;
+	}
+	for(auto y = range.min_y; y <= range.max_y; ++y) {
+		for(auto x = range.min_x; x <= range.max_x; ++x) {
+			if(const auto it = cells_.find(key(x, y)); it != cells_.end()) {
+				erase_item(it->second, item);
+			}
+		}
+	}
+}
+
+auto spatial_hash::erase_item(std::vector<std::uint32_t> &items, const std::uint32_t item) -> void {
+	if(const auto it = std::ranges::find(items, item); it != items.end()) {
+		*it = items.back();
+		items.pop_back();
+	}
+}
+
+} // namespace pxe
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2026 Juan Medina
+// SPDX-License-Identifier: MIT
+
+#include <pxe/tick_scheduler.hpp>
+
+#include <thread>
+
+namespace pxe {
+
+auto tick_scheduler::begin_frame() -> void {
+	frame_thread_ = std::this_thread::get_id();
+	stats_ = frame_stats{};
+	depth_ = 0;
+}
+
+auto tick_scheduler::has_time() const -> bool {
+	if(budget_ == clock::duration::zero()) {
+		return true;
+	}
+	return stats_.spent + (clock::now() - run_start_) < budget_;
+}
+
+// only the outermost run measures, the time of the nested ones is already part of it
+auto tick_scheduler::enter() -> void {
+	if(depth_++ == 0) {
+		run_start_ = clock::now();
+	}
+}
+
+auto tick_scheduler::leave() -> void {
+	if(--depth_ == 0) {
+		stats_.spent += clock::now() - run_start_;
+	}
+}
+
+} // namespace pxe